@@ -6,46 +6,38 @@
 #include "executer/desired_group_data.hpp"
 #include "log_anywhere/log_anywhere.hpp"
 #include "node/node_map.hpp"
+#include "task/external_clock.hpp"
 #include "node_test.hpp"
 #include "yaml_template/task/yaml_load_generated_classes.hpp"
 
 using namespace ocm;
 
-// 定义一个继承自TaskBase的任务类，用于定时任务
+// 定义一个继承自TaskBase的任务类，用于驱动外部时钟
 class TaskTimer : public ocm::TaskBase {
  public:
   // 构造函数，初始化任务名称、定时器类型、周期等
   TaskTimer() : ocm::TaskBase("openrobot_task_timer", ocm::TimerType::INTERNAL_TIMER, 0.0, false, false) {
-    // 定义信号量名称列表
-    std::vector<std::string> sem_name_list = {"executer", "resident_task_1", "standby_task_1", "standby_task_2", "standby_task_3"};
-    // 创建信号量和共享内存数据
-    for (const auto& sem_name : sem_name_list) {
-      sem_.emplace_back(SharedMemorySemaphore(sem_name, 0));
-      shm_.emplace_back(SharedMemoryData<uint8_t>(sem_name, true, sizeof(uint8_t)));
-    }
-    // 初始化共享内存数据
-    for (auto& shm : shm_) {
-      shm.Lock();
-      *shm.Get() = 1;  // 设置为1毫秒
-      shm.UnLock();
+    // 定义外部时钟名称列表
+    std::vector<std::string> clock_name_list = {"resident_task_1", "standby_task_1", "standby_task_2", "standby_task_3"};
+    // 创建节拍周期为1毫秒的外部时钟
+    for (const auto& clock_name : clock_name_list) {
+      clock_.push_back(std::make_unique<ExternalClock>(clock_name, 0.001));
     }
   }
 
   // 默认析构函数
   ~TaskTimer() = default;
 
-  // 重写Run方法，每次运行时递增信号量
+  // 重写Run方法，每次运行时推进一个节拍
   void Run() override {
-    for (auto& sem : sem_) {
-      sem.IncrementWhenZero();
+    for (auto& clock : clock_) {
+      clock->Tick();
     }
   }
 
  private:
-  // 信号量列表
-  std::vector<ocm::SharedMemorySemaphore> sem_;
-  // 共享内存数据列表
-  std::vector<ocm::SharedMemoryData<uint8_t>> shm_;
+  // 外部时钟列表
+  std::vector<std::unique_ptr<ocm::ExternalClock>> clock_;
 };
 
 int main() {
@@ -93,17 +85,34 @@ int main() {
   executer_config.executer_setting.package_name = "executer";
   executer_config.executer_setting.timer_setting.timer_type = timer_type_map.at(executer_setting.TimerSetting().TimerType());
   executer_config.executer_setting.timer_setting.period = executer_setting.TimerSetting().Period();
+  executer_config.executer_setting.timer_setting.overrun_policy = overrun_policy_map.at(executer_setting.TimerSetting().OverrunPolicy());
+  executer_config.executer_setting.timer_setting.phase = executer_setting.TimerSetting().Phase();
   executer_config.executer_setting.system_setting.priority = static_cast<int>(executer_setting.SystemSetting().Priority());
   // executer_config.executer_setting.system_setting.cpu_affinity = executer_setting.SystemSetting().ExecuterCpuAffinity();
+  executer_config.executer_setting.auto_phase_enable = executer_setting.AutoPhaseEnable();
+  executer_config.executer_setting.worker_num = static_cast<int>(executer_setting.WorkerNum());
+  executer_config.executer_setting.prewarm_enable = executer_setting.PrewarmEnable();
+  executer_config.executer_setting.overlap_transition_enable = executer_setting.OverlapTransitionEnable();
+  executer_config.executer_setting.timer_service_tick = executer_setting.TimerServiceTick();
+  executer_config.executer_setting.timer_service_priority = static_cast<int>(executer_setting.TimerServicePriority());
 
   // 配置常驻任务组
   for (const auto& task : task_list.ResidentGroup()) {
     TaskSetting task_setting;
-    task_setting.task_name = task.TaskName();                                                    // 任务名称
-    task_setting.timer_setting.timer_type = timer_type_map.at(task.TimerSetting().TimerType());  // 定时器类型
-    task_setting.timer_setting.period = task.TimerSetting().Period();                            // 定周期
-    task_setting.system_setting.priority = task.SystemSetting().Priority();                      // 系统优先级
+    task_setting.task_name = task.TaskName();                                                                // 任务名称
+    task_setting.real_time = task.RealTime();                                                                // 是否为实时任务
+    task_setting.parallel_enable = task.ParallelEnable();                                                    // 是否按节点依赖图并行执行
+    task_setting.profile_enable = task.ProfileEnable();                                                      // 是否统计节点耗时
+    task_setting.timer_setting.timer_type = timer_type_map.at(task.TimerSetting().TimerType());              // 定时器类型
+    task_setting.timer_setting.period = task.TimerSetting().Period();                                        // 定周期
+    task_setting.timer_setting.overrun_policy = overrun_policy_map.at(task.TimerSetting().OverrunPolicy());  // 超限策略
+    task_setting.timer_setting.phase = task.TimerSetting().Phase();                                          // 相位偏移
+    task_setting.system_setting.priority = task.SystemSetting().Priority();                                  // 系统优先级
     // task_setting.system_setting.cpu_affinity = task.SystemSetting().CpuAffinity();
+    task_setting.system_setting.sched_policy = sched_policy_map.at(task.SystemSetting().SchedPolicy());  // 调度策略
+    task_setting.system_setting.sched_runtime = task.SystemSetting().SchedRuntime();                     // 截止时间调度的运行预算
+    task_setting.system_setting.sched_deadline = task.SystemSetting().SchedDeadline();                   // 截止时间调度的相对截止时间
+    task_setting.system_setting.sched_period = task.SystemSetting().SchedPeriod();                       // 截止时间调度的周期
     task_setting.launch_setting.pre_node = task.LaunchSetting().PreNode();  // 前置节点
     task_setting.launch_setting.delay = task.LaunchSetting().Delay();       // 延迟
     // 添加节点配置
@@ -111,6 +120,9 @@ int main() {
       NodeConfig node_config;
       node_config.node_name = node.NodeName();          // 节点名称
       node_config.output_enable = node.OutputEnable();  // 是否启用输出
+      node_config.depend = node.Depend();               // 依赖的节点
+      node_config.rate_divisor = node.RateDivisor();    // 分频系数
+      node_config.rate_phase = node.RatePhase();        // 分频相位
       task_setting.node_list.push_back(node_config);
     }
     executer_config.task_list.resident_group[task.TaskName()] = task_setting;  // 添加到常驻任务组
@@ -119,16 +131,28 @@ int main() {
   // 配置备用任务组
   for (const auto& task : task_list.StandbyGroup()) {
     TaskSetting task_setting;
-    task_setting.task_name = task.TaskName();                                                    // 任务名称
-    task_setting.timer_setting.timer_type = timer_type_map.at(task.TimerSetting().TimerType());  // 定时器类型
-    task_setting.timer_setting.period = task.TimerSetting().Period();                            // 定周期
-    task_setting.system_setting.priority = task.SystemSetting().Priority();                      // 系统优先级
+    task_setting.task_name = task.TaskName();                                                                // 任务名称
+    task_setting.real_time = task.RealTime();                                                                // 是否为实时任务
+    task_setting.parallel_enable = task.ParallelEnable();                                                    // 是否按节点依赖图并行执行
+    task_setting.profile_enable = task.ProfileEnable();                                                      // 是否统计节点耗时
+    task_setting.timer_setting.timer_type = timer_type_map.at(task.TimerSetting().TimerType());              // 定时器类型
+    task_setting.timer_setting.period = task.TimerSetting().Period();                                        // 定周期
+    task_setting.timer_setting.overrun_policy = overrun_policy_map.at(task.TimerSetting().OverrunPolicy());  // 超限策略
+    task_setting.timer_setting.phase = task.TimerSetting().Phase();                                          // 相位偏移
+    task_setting.system_setting.priority = task.SystemSetting().Priority();                                  // 系统优先级
     // task_setting.system_setting.cpu_affinity = task.SystemSetting().CpuAffinity();
+    task_setting.system_setting.sched_policy = sched_policy_map.at(task.SystemSetting().SchedPolicy());  // 调度策略
+    task_setting.system_setting.sched_runtime = task.SystemSetting().SchedRuntime();                     // 截止时间调度的运行预算
+    task_setting.system_setting.sched_deadline = task.SystemSetting().SchedDeadline();                   // 截止时间调度的相对截止时间
+    task_setting.system_setting.sched_period = task.SystemSetting().SchedPeriod();                       // 截止时间调度的周期
     // 添加节点配置
     for (const auto& node : task.NodeList()) {
       NodeConfig node_config;
       node_config.node_name = node.NodeName();          // 节点名称
       node_config.output_enable = node.OutputEnable();  // 是否启用输出
+      node_config.depend = node.Depend();               // 依赖的节点
+      node_config.rate_divisor = node.RateDivisor();    // 分频系数
+      node_config.rate_phase = node.RatePhase();        // 分频相位
       task_setting.node_list.push_back(node_config);
     }
     executer_config.task_list.standby_group[task.TaskName()] = task_setting;  // 添加到备用任务组
@@ -149,6 +173,14 @@ int main() {
     executer_config.exclusive_task_group[group.GroupName()] = group_setting;  // 添加到排他任务组
   }
 
+  // 配置节点数据端口连接
+  for (const auto& connection : config.get_task_config().PortConnection()) {
+    PortConnection port_connection;
+    port_connection.output = connection.Output();  // 输出端口
+    port_connection.input = connection.Input();    // 输入端口
+    executer_config.port_connection.push_back(port_connection);
+  }
+
   // 创建执行器实例
   Executer executer(executer_config, node_map, "executer_desired_group");
   executer.CreateTask();  // 创建任务
@@ -158,10 +190,10 @@ int main() {
   SharedMemoryTopicLcm desired_group_topic;
   DesiredGroupData desired_group_data;
   desired_group_data.desired_group = "passive";  // 设置期望组为"passive"
-  desired_group_topic.Publish("executer_desired_group", "executer_desired_group", &desired_group_data);
+  desired_group_topic.Publish("executer_desired_group_lcm", "executer_desired_group_lcm", &desired_group_data);
   std::this_thread::sleep_for(std::chrono::seconds(3));  // 等待3秒
   desired_group_data.desired_group = "pdstand";          // 设置期望组为"pdstand"
-  desired_group_topic.Publish("executer_desired_group", "executer_desired_group", &desired_group_data);
+  desired_group_topic.Publish("executer_desired_group_lcm", "executer_desired_group_lcm", &desired_group_data);
   std::this_thread::sleep_for(std::chrono::seconds(6));  // 等待6秒
 
   // 输出退出信息
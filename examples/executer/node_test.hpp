@@ -6,7 +6,10 @@ class NodeA : public ocm::NodeBase {
   NodeA(const std::string& node_name) : ocm::NodeBase(node_name) {}
   void Construct() override { std::cout << "NodeA Construct" << std::endl; }
   void Init() override { std::cout << "NodeA Init" << std::endl; }
-  void Execute() override { std::cout << "NodeA Run" << std::endl; }
+  void Execute() override {
+    count_out_.Write() = ++count_;  // 直接写入输出端口的缓冲区
+    std::cout << "NodeA Run" << std::endl;
+  }
   void Output() override { std::cout << "NodeA Output" << std::endl; }
   bool TryEnter() override {
     std::cout << "NodeA TryEnter" << std::endl;
@@ -17,6 +20,10 @@ class NodeA : public ocm::NodeBase {
     return true;
   }
   void AfterExit() override { std::cout << "NodeA AfterExit" << std::endl; }
+
+ private:
+  int count_ = 0;
+  ocm::OutputPort<int> count_out_{this, "count"};
 };
 
 class NodeB : public ocm::NodeBase {
@@ -24,7 +31,7 @@ class NodeB : public ocm::NodeBase {
   NodeB(const std::string& node_name) : ocm::NodeBase(node_name) {}
   void Construct() override { std::cout << "NodeB Construct" << std::endl; }
   void Init() override { std::cout << "NodeB Init" << std::endl; }
-  void Execute() override { std::cout << "NodeB Run" << std::endl; }
+  void Execute() override { std::cout << "NodeB Run, count " << count_in_.Get() << std::endl; }
   void Output() override { std::cout << "NodeB Output" << std::endl; }
   bool TryEnter() override {
     std::cout << "NodeB TryEnter" << std::endl;
@@ -35,6 +42,9 @@ class NodeB : public ocm::NodeBase {
     return true;
   }
   void AfterExit() override { std::cout << "NodeB AfterExit" << std::endl; }
+
+ private:
+  ocm::InputPort<int> count_in_{this, "count"};
 };
 
 class NodeC : public ocm::NodeBase {
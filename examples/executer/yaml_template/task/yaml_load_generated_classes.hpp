@@ -27,22 +27,32 @@ class TimerSetting {
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["timer_type"]) timer_type_ = auto_yaml_node["timer_type"].as<std::string>();
     if (auto_yaml_node["period"]) period_ = auto_yaml_node["period"].as<double>();
+    if (auto_yaml_node["overrun_policy"]) overrun_policy_ = auto_yaml_node["overrun_policy"].as<std::string>();
+    if (auto_yaml_node["phase"]) phase_ = auto_yaml_node["phase"].as<double>();
   }
 
   std::string TimerType() const { return timer_type_; }
 
   double Period() const { return period_; }
 
+  std::string OverrunPolicy() const { return overrun_policy_; }
+
+  double Phase() const { return phase_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "TimerSetting:" << std::endl;
     std::cout << indent << "    timer_type_: " << timer_type_ << std::endl;
     std::cout << indent << "    period_: " << period_ << std::endl;
+    std::cout << indent << "    overrun_policy_: " << overrun_policy_ << std::endl;
+    std::cout << indent << "    phase_: " << phase_ << std::endl;
   }
 
  private:
   std::string timer_type_;
   double period_;
+  std::string overrun_policy_;
+  double phase_;
 };
 
 }  // namespace auto_TimerSetting
@@ -164,6 +174,12 @@ class ExecuterSetting {
     if (auto_yaml_node["idle_system_setting"]) idle_system_setting_.update_from_yaml(auto_yaml_node["idle_system_setting"]);
     if (auto_yaml_node["all_priority_enable"]) all_priority_enable_ = auto_yaml_node["all_priority_enable"].as<bool>();
     if (auto_yaml_node["all_cpu_affinity_enable"]) all_cpu_affinity_enable_ = auto_yaml_node["all_cpu_affinity_enable"].as<bool>();
+    if (auto_yaml_node["auto_phase_enable"]) auto_phase_enable_ = auto_yaml_node["auto_phase_enable"].as<bool>();
+    if (auto_yaml_node["worker_num"]) worker_num_ = auto_yaml_node["worker_num"].as<double>();
+    if (auto_yaml_node["prewarm_enable"]) prewarm_enable_ = auto_yaml_node["prewarm_enable"].as<bool>();
+    if (auto_yaml_node["overlap_transition_enable"]) overlap_transition_enable_ = auto_yaml_node["overlap_transition_enable"].as<bool>();
+    if (auto_yaml_node["timer_service_tick"]) timer_service_tick_ = auto_yaml_node["timer_service_tick"].as<double>();
+    if (auto_yaml_node["timer_service_priority"]) timer_service_priority_ = auto_yaml_node["timer_service_priority"].as<double>();
   }
 
   const auto_TaskConfig::auto_ExecuterSetting::auto_TimerSetting::TimerSetting& TimerSetting() const { return timer_setting_; }
@@ -176,6 +192,18 @@ class ExecuterSetting {
 
   bool AllCpuAffinityEnable() const { return all_cpu_affinity_enable_; }
 
+  bool AutoPhaseEnable() const { return auto_phase_enable_; }
+
+  double WorkerNum() const { return worker_num_; }
+
+  bool PrewarmEnable() const { return prewarm_enable_; }
+
+  bool OverlapTransitionEnable() const { return overlap_transition_enable_; }
+
+  double TimerServiceTick() const { return timer_service_tick_; }
+
+  double TimerServicePriority() const { return timer_service_priority_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "ExecuterSetting:" << std::endl;
@@ -187,6 +215,12 @@ class ExecuterSetting {
     idle_system_setting_.print(indent_level + 1);
     std::cout << indent << "    all_priority_enable_: " << all_priority_enable_ << std::endl;
     std::cout << indent << "    all_cpu_affinity_enable_: " << all_cpu_affinity_enable_ << std::endl;
+    std::cout << indent << "    auto_phase_enable_: " << auto_phase_enable_ << std::endl;
+    std::cout << indent << "    worker_num_: " << worker_num_ << std::endl;
+    std::cout << indent << "    prewarm_enable_: " << prewarm_enable_ << std::endl;
+    std::cout << indent << "    overlap_transition_enable_: " << overlap_transition_enable_ << std::endl;
+    std::cout << indent << "    timer_service_tick_: " << timer_service_tick_ << std::endl;
+    std::cout << indent << "    timer_service_priority_: " << timer_service_priority_ << std::endl;
   }
 
  private:
@@ -195,6 +229,12 @@ class ExecuterSetting {
   auto_TaskConfig::auto_ExecuterSetting::auto_IdleSystemSetting::IdleSystemSetting idle_system_setting_;
   bool all_priority_enable_;
   bool all_cpu_affinity_enable_;
+  bool auto_phase_enable_;
+  double worker_num_;
+  bool prewarm_enable_;
+  bool overlap_transition_enable_;
+  double timer_service_tick_;
+  double timer_service_priority_;
 };
 
 }  // namespace auto_ExecuterSetting
@@ -218,22 +258,46 @@ class NodeList {
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["node_name"]) node_name_ = auto_yaml_node["node_name"].as<std::string>();
     if (auto_yaml_node["output_enable"]) output_enable_ = auto_yaml_node["output_enable"].as<bool>();
+    if (auto_yaml_node["depend"]) {
+      depend_.clear();
+      for (auto& item : auto_yaml_node["depend"]) {
+        depend_.push_back(item.as<std::string>());
+      }
+    }
+    if (auto_yaml_node["rate_divisor"]) rate_divisor_ = auto_yaml_node["rate_divisor"].as<int>();
+    if (auto_yaml_node["rate_phase"]) rate_phase_ = auto_yaml_node["rate_phase"].as<int>();
   }
 
   std::string NodeName() const { return node_name_; }
 
   bool OutputEnable() const { return output_enable_; }
 
+  std::vector<std::string> Depend() const { return depend_; }
+
+  int RateDivisor() const { return rate_divisor_; }
+
+  int RatePhase() const { return rate_phase_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "NodeList:" << std::endl;
     std::cout << indent << "    node_name_: " << node_name_ << std::endl;
     std::cout << indent << "    output_enable_: " << output_enable_ << std::endl;
+    std::cout << indent << "    depend_: [" << std::endl;
+    for (const auto& item : depend_) {
+      std::cout << indent << "        " << item << std::endl;
+    }
+    std::cout << indent << "    ]" << std::endl;
+    std::cout << indent << "    rate_divisor_: " << rate_divisor_ << std::endl;
+    std::cout << indent << "    rate_phase_: " << rate_phase_ << std::endl;
   }
 
  private:
   std::string node_name_;
   bool output_enable_;
+  std::vector<std::string> depend_;
+  int rate_divisor_;
+  int rate_phase_;
 };
 
 }  // namespace auto_NodeList
@@ -259,22 +323,32 @@ class TimerSetting {
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["timer_type"]) timer_type_ = auto_yaml_node["timer_type"].as<std::string>();
     if (auto_yaml_node["period"]) period_ = auto_yaml_node["period"].as<double>();
+    if (auto_yaml_node["overrun_policy"]) overrun_policy_ = auto_yaml_node["overrun_policy"].as<std::string>();
+    if (auto_yaml_node["phase"]) phase_ = auto_yaml_node["phase"].as<double>();
   }
 
   std::string TimerType() const { return timer_type_; }
 
   double Period() const { return period_; }
 
+  std::string OverrunPolicy() const { return overrun_policy_; }
+
+  double Phase() const { return phase_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "TimerSetting:" << std::endl;
     std::cout << indent << "    timer_type_: " << timer_type_ << std::endl;
     std::cout << indent << "    period_: " << period_ << std::endl;
+    std::cout << indent << "    overrun_policy_: " << overrun_policy_ << std::endl;
+    std::cout << indent << "    phase_: " << phase_ << std::endl;
   }
 
  private:
   std::string timer_type_;
   double period_;
+  std::string overrun_policy_;
+  double phase_;
 };
 
 }  // namespace auto_TimerSetting
@@ -305,12 +379,24 @@ class SystemSetting {
         cpu_affinity_.push_back(item.as<double>());
       }
     }
+    if (auto_yaml_node["sched_policy"]) sched_policy_ = auto_yaml_node["sched_policy"].as<std::string>();
+    if (auto_yaml_node["sched_runtime"]) sched_runtime_ = auto_yaml_node["sched_runtime"].as<double>();
+    if (auto_yaml_node["sched_deadline"]) sched_deadline_ = auto_yaml_node["sched_deadline"].as<double>();
+    if (auto_yaml_node["sched_period"]) sched_period_ = auto_yaml_node["sched_period"].as<double>();
   }
 
   double Priority() const { return priority_; }
 
   std::vector<double> CpuAffinity() const { return cpu_affinity_; }
 
+  std::string SchedPolicy() const { return sched_policy_; }
+
+  double SchedRuntime() const { return sched_runtime_; }
+
+  double SchedDeadline() const { return sched_deadline_; }
+
+  double SchedPeriod() const { return sched_period_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "SystemSetting:" << std::endl;
@@ -320,11 +406,19 @@ class SystemSetting {
       std::cout << indent << "        " << item << std::endl;
     }
     std::cout << indent << "    ]" << std::endl;
+    std::cout << indent << "    sched_policy_: " << sched_policy_ << std::endl;
+    std::cout << indent << "    sched_runtime_: " << sched_runtime_ << std::endl;
+    std::cout << indent << "    sched_deadline_: " << sched_deadline_ << std::endl;
+    std::cout << indent << "    sched_period_: " << sched_period_ << std::endl;
   }
 
  private:
   double priority_;
   std::vector<double> cpu_affinity_;
+  std::string sched_policy_;
+  double sched_runtime_;
+  double sched_deadline_;
+  double sched_period_;
 };
 
 }  // namespace auto_SystemSetting
@@ -398,6 +492,9 @@ class ResidentGroup {
 
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["task_name"]) task_name_ = auto_yaml_node["task_name"].as<std::string>();
+    if (auto_yaml_node["real_time"]) real_time_ = auto_yaml_node["real_time"].as<bool>();
+    if (auto_yaml_node["parallel_enable"]) parallel_enable_ = auto_yaml_node["parallel_enable"].as<bool>();
+    if (auto_yaml_node["profile_enable"]) profile_enable_ = auto_yaml_node["profile_enable"].as<bool>();
     if (auto_yaml_node["node_list"]) {
       node_list_.clear();
       for (auto& item : auto_yaml_node["node_list"]) {
@@ -413,6 +510,12 @@ class ResidentGroup {
 
   std::string TaskName() const { return task_name_; }
 
+  bool RealTime() const { return real_time_; }
+
+  bool ParallelEnable() const { return parallel_enable_; }
+
+  bool ProfileEnable() const { return profile_enable_; }
+
   std::vector<auto_TaskConfig::auto_TaskList::auto_ResidentGroup::auto_NodeList::NodeList> NodeList() const { return node_list_; }
 
   const auto_TaskConfig::auto_TaskList::auto_ResidentGroup::auto_TimerSetting::TimerSetting& TimerSetting() const { return timer_setting_; }
@@ -425,6 +528,9 @@ class ResidentGroup {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "ResidentGroup:" << std::endl;
     std::cout << indent << "    task_name_: " << task_name_ << std::endl;
+    std::cout << indent << "    real_time_: " << real_time_ << std::endl;
+    std::cout << indent << "    parallel_enable_: " << parallel_enable_ << std::endl;
+    std::cout << indent << "    profile_enable_: " << profile_enable_ << std::endl;
     std::cout << indent << "    node_list_: [" << std::endl;
     for (const auto& item : node_list_) {
       item.print(indent_level + 2);
@@ -440,6 +546,9 @@ class ResidentGroup {
 
  private:
   std::string task_name_;
+  bool real_time_;
+  bool parallel_enable_;
+  bool profile_enable_;
   std::vector<auto_TaskConfig::auto_TaskList::auto_ResidentGroup::auto_NodeList::NodeList> node_list_;
   auto_TaskConfig::auto_TaskList::auto_ResidentGroup::auto_TimerSetting::TimerSetting timer_setting_;
   auto_TaskConfig::auto_TaskList::auto_ResidentGroup::auto_SystemSetting::SystemSetting system_setting_;
@@ -468,22 +577,46 @@ class NodeList {
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["node_name"]) node_name_ = auto_yaml_node["node_name"].as<std::string>();
     if (auto_yaml_node["output_enable"]) output_enable_ = auto_yaml_node["output_enable"].as<bool>();
+    if (auto_yaml_node["depend"]) {
+      depend_.clear();
+      for (auto& item : auto_yaml_node["depend"]) {
+        depend_.push_back(item.as<std::string>());
+      }
+    }
+    if (auto_yaml_node["rate_divisor"]) rate_divisor_ = auto_yaml_node["rate_divisor"].as<int>();
+    if (auto_yaml_node["rate_phase"]) rate_phase_ = auto_yaml_node["rate_phase"].as<int>();
   }
 
   std::string NodeName() const { return node_name_; }
 
   bool OutputEnable() const { return output_enable_; }
 
+  std::vector<std::string> Depend() const { return depend_; }
+
+  int RateDivisor() const { return rate_divisor_; }
+
+  int RatePhase() const { return rate_phase_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "NodeList:" << std::endl;
     std::cout << indent << "    node_name_: " << node_name_ << std::endl;
     std::cout << indent << "    output_enable_: " << output_enable_ << std::endl;
+    std::cout << indent << "    depend_: [" << std::endl;
+    for (const auto& item : depend_) {
+      std::cout << indent << "        " << item << std::endl;
+    }
+    std::cout << indent << "    ]" << std::endl;
+    std::cout << indent << "    rate_divisor_: " << rate_divisor_ << std::endl;
+    std::cout << indent << "    rate_phase_: " << rate_phase_ << std::endl;
   }
 
  private:
   std::string node_name_;
   bool output_enable_;
+  std::vector<std::string> depend_;
+  int rate_divisor_;
+  int rate_phase_;
 };
 
 }  // namespace auto_NodeList
@@ -509,22 +642,32 @@ class TimerSetting {
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["timer_type"]) timer_type_ = auto_yaml_node["timer_type"].as<std::string>();
     if (auto_yaml_node["period"]) period_ = auto_yaml_node["period"].as<double>();
+    if (auto_yaml_node["overrun_policy"]) overrun_policy_ = auto_yaml_node["overrun_policy"].as<std::string>();
+    if (auto_yaml_node["phase"]) phase_ = auto_yaml_node["phase"].as<double>();
   }
 
   std::string TimerType() const { return timer_type_; }
 
   double Period() const { return period_; }
 
+  std::string OverrunPolicy() const { return overrun_policy_; }
+
+  double Phase() const { return phase_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "TimerSetting:" << std::endl;
     std::cout << indent << "    timer_type_: " << timer_type_ << std::endl;
     std::cout << indent << "    period_: " << period_ << std::endl;
+    std::cout << indent << "    overrun_policy_: " << overrun_policy_ << std::endl;
+    std::cout << indent << "    phase_: " << phase_ << std::endl;
   }
 
  private:
   std::string timer_type_;
   double period_;
+  std::string overrun_policy_;
+  double phase_;
 };
 
 }  // namespace auto_TimerSetting
@@ -555,12 +698,24 @@ class SystemSetting {
         cpu_affinity_.push_back(item.as<double>());
       }
     }
+    if (auto_yaml_node["sched_policy"]) sched_policy_ = auto_yaml_node["sched_policy"].as<std::string>();
+    if (auto_yaml_node["sched_runtime"]) sched_runtime_ = auto_yaml_node["sched_runtime"].as<double>();
+    if (auto_yaml_node["sched_deadline"]) sched_deadline_ = auto_yaml_node["sched_deadline"].as<double>();
+    if (auto_yaml_node["sched_period"]) sched_period_ = auto_yaml_node["sched_period"].as<double>();
   }
 
   double Priority() const { return priority_; }
 
   std::vector<double> CpuAffinity() const { return cpu_affinity_; }
 
+  std::string SchedPolicy() const { return sched_policy_; }
+
+  double SchedRuntime() const { return sched_runtime_; }
+
+  double SchedDeadline() const { return sched_deadline_; }
+
+  double SchedPeriod() const { return sched_period_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "SystemSetting:" << std::endl;
@@ -570,11 +725,19 @@ class SystemSetting {
       std::cout << indent << "        " << item << std::endl;
     }
     std::cout << indent << "    ]" << std::endl;
+    std::cout << indent << "    sched_policy_: " << sched_policy_ << std::endl;
+    std::cout << indent << "    sched_runtime_: " << sched_runtime_ << std::endl;
+    std::cout << indent << "    sched_deadline_: " << sched_deadline_ << std::endl;
+    std::cout << indent << "    sched_period_: " << sched_period_ << std::endl;
   }
 
  private:
   double priority_;
   std::vector<double> cpu_affinity_;
+  std::string sched_policy_;
+  double sched_runtime_;
+  double sched_deadline_;
+  double sched_period_;
 };
 
 }  // namespace auto_SystemSetting
@@ -598,6 +761,9 @@ class StandbyGroup {
 
   void update_from_yaml(const YAML::Node& auto_yaml_node) {
     if (auto_yaml_node["task_name"]) task_name_ = auto_yaml_node["task_name"].as<std::string>();
+    if (auto_yaml_node["real_time"]) real_time_ = auto_yaml_node["real_time"].as<bool>();
+    if (auto_yaml_node["parallel_enable"]) parallel_enable_ = auto_yaml_node["parallel_enable"].as<bool>();
+    if (auto_yaml_node["profile_enable"]) profile_enable_ = auto_yaml_node["profile_enable"].as<bool>();
     if (auto_yaml_node["node_list"]) {
       node_list_.clear();
       for (auto& item : auto_yaml_node["node_list"]) {
@@ -612,6 +778,12 @@ class StandbyGroup {
 
   std::string TaskName() const { return task_name_; }
 
+  bool RealTime() const { return real_time_; }
+
+  bool ParallelEnable() const { return parallel_enable_; }
+
+  bool ProfileEnable() const { return profile_enable_; }
+
   std::vector<auto_TaskConfig::auto_TaskList::auto_StandbyGroup::auto_NodeList::NodeList> NodeList() const { return node_list_; }
 
   const auto_TaskConfig::auto_TaskList::auto_StandbyGroup::auto_TimerSetting::TimerSetting& TimerSetting() const { return timer_setting_; }
@@ -622,6 +794,9 @@ class StandbyGroup {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "StandbyGroup:" << std::endl;
     std::cout << indent << "    task_name_: " << task_name_ << std::endl;
+    std::cout << indent << "    real_time_: " << real_time_ << std::endl;
+    std::cout << indent << "    parallel_enable_: " << parallel_enable_ << std::endl;
+    std::cout << indent << "    profile_enable_: " << profile_enable_ << std::endl;
     std::cout << indent << "    node_list_: [" << std::endl;
     for (const auto& item : node_list_) {
       item.print(indent_level + 2);
@@ -635,6 +810,9 @@ class StandbyGroup {
 
  private:
   std::string task_name_;
+  bool real_time_;
+  bool parallel_enable_;
+  bool profile_enable_;
   std::vector<auto_TaskConfig::auto_TaskList::auto_StandbyGroup::auto_NodeList::NodeList> node_list_;
   auto_TaskConfig::auto_TaskList::auto_StandbyGroup::auto_TimerSetting::TimerSetting timer_setting_;
   auto_TaskConfig::auto_TaskList::auto_StandbyGroup::auto_SystemSetting::SystemSetting system_setting_;
@@ -813,6 +991,43 @@ class ExclusiveTaskGroup {
 }  // namespace auto_ExclusiveTaskGroup
 }  // namespace auto_TaskConfig
 
+namespace auto_TaskConfig {
+namespace auto_PortConnection {
+class PortConnection {
+ public:
+  PortConnection() = default;
+  ~PortConnection() = default;
+
+  PortConnection(const PortConnection&) = default;
+  PortConnection& operator=(const PortConnection&) = default;
+
+  PortConnection(PortConnection&&) = default;
+  PortConnection& operator=(PortConnection&&) = default;
+
+  void update_from_yaml(const YAML::Node& auto_yaml_node) {
+    if (auto_yaml_node["output"]) output_ = auto_yaml_node["output"].as<std::string>();
+    if (auto_yaml_node["input"]) input_ = auto_yaml_node["input"].as<std::string>();
+  }
+
+  std::string Output() const { return output_; }
+
+  std::string Input() const { return input_; }
+
+  void print(int indent_level = 0) const {
+    std::string indent(indent_level * 4, ' ');
+    std::cout << indent << "PortConnection:" << std::endl;
+    std::cout << indent << "    output_: " << output_ << std::endl;
+    std::cout << indent << "    input_: " << input_ << std::endl;
+  }
+
+ private:
+  std::string output_;
+  std::string input_;
+};
+
+}  // namespace auto_PortConnection
+}  // namespace auto_TaskConfig
+
 namespace auto_TaskConfig {
 class TaskConfig {
  public:
@@ -836,6 +1051,14 @@ class TaskConfig {
         exclusive_task_group_.push_back(elem);
       }
     }
+    if (auto_yaml_node["port_connection"]) {
+      port_connection_.clear();
+      for (auto& item : auto_yaml_node["port_connection"]) {
+        auto_TaskConfig::auto_PortConnection::PortConnection elem;
+        elem.update_from_yaml(item);
+        port_connection_.push_back(elem);
+      }
+    }
   }
 
   const auto_TaskConfig::auto_ExecuterSetting::ExecuterSetting& ExecuterSetting() const { return executer_setting_; }
@@ -844,6 +1067,8 @@ class TaskConfig {
 
   std::vector<auto_TaskConfig::auto_ExclusiveTaskGroup::ExclusiveTaskGroup> ExclusiveTaskGroup() const { return exclusive_task_group_; }
 
+  std::vector<auto_TaskConfig::auto_PortConnection::PortConnection> PortConnection() const { return port_connection_; }
+
   void print(int indent_level = 0) const {
     std::string indent(indent_level * 4, ' ');
     std::cout << indent << "TaskConfig:" << std::endl;
@@ -856,12 +1081,18 @@ class TaskConfig {
       item.print(indent_level + 2);
     }
     std::cout << indent << "    ]" << std::endl;
+    std::cout << indent << "    port_connection_: [" << std::endl;
+    for (const auto& item : port_connection_) {
+      item.print(indent_level + 2);
+    }
+    std::cout << indent << "    ]" << std::endl;
   }
 
  private:
   auto_TaskConfig::auto_ExecuterSetting::ExecuterSetting executer_setting_;
   auto_TaskConfig::auto_TaskList::TaskList task_list_;
   std::vector<auto_TaskConfig::auto_ExclusiveTaskGroup::ExclusiveTaskGroup> exclusive_task_group_;
+  std::vector<auto_TaskConfig::auto_PortConnection::PortConnection> port_connection_;
 };
 
 }  // namespace auto_TaskConfig
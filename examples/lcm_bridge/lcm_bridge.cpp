@@ -0,0 +1,49 @@
+#include <iostream>
+#include <lcm/lcm-cpp.hpp>
+#include "bridge/lcm_bridge.hpp"
+#include "debug_anywhere/debug_data.hpp"
+#include "ocm/shared_memory_topic_lcm.hpp"
+
+using namespace ocm;
+
+// 回环测试前需为回环网卡添加多播路由：sudo ip route add 239.0.0.0/8 dev lo
+int main() {
+  // 配置桥接：bridge_out 话题转发到 LCM 通道 BRIDGE_OUT，LCM 通道 BRIDGE_IN 转发到 bridge_in 话题
+  LcmBridgeConfig config;
+  config.interface_ip = "127.0.0.1";  // 回环网卡
+  config.period = 0.001;              // 1毫秒轮询
+  config.system_setting.priority = 0;
+  config.outbound.push_back({"bridge_out", "bridge_out", "BRIDGE_OUT", 100.0});  // 限频100Hz
+  config.inbound.push_back({"bridge_in", "bridge_in", "BRIDGE_IN", 0.0});
+  LcmBridge bridge(config);
+
+  // 标准LCM订阅者接收桥接发出的报文
+  lcm::LCM lcm("udpm://239.255.76.67:7667?ttl=0");
+  if (!lcm.good()) return 1;
+  lcm.subscribe("BRIDGE_OUT", [](const lcm::ReceiveBuffer* rbuf, const std::string& channel) {
+    DebugData msg;
+    msg.decode(rbuf->data, 0, rbuf->data_size);
+    std::cout << "LCM received " << channel << ": " << msg.data[0] << std::endl;
+  });
+
+  // 向共享内存话题发布数据，由桥接转发到LCM
+  SharedMemoryTopicLcm topic;
+  DebugData data;
+  data.count = 1;
+  data.data = {0.0};
+  for (int i = 0; i < 10; ++i) {
+    data.data[0] = i;
+    topic.Publish("bridge_out", "bridge_out", &data);
+    lcm.handleTimeout(20);
+  }
+
+  // 由LCM发布数据，桥接写入共享内存话题
+  data.data[0] = 42.0;
+  lcm.publish("BRIDGE_IN", &data);
+  topic.SubscribeTimeout<DebugData>(
+      "bridge_in", "bridge_in", [](const DebugData& msg) { std::cout << "SHM received bridge_in: " << msg.data[0] << std::endl; }, 1000);
+
+  std::cout << "sent " << bridge.GetSendCount() << ", received " << bridge.GetReceiveCount() << ", dropped " << bridge.GetDropCount() << std::endl;
+  bridge.TaskDestroy();  // 销毁桥接任务
+  return 0;
+}
@@ -1,5 +1,6 @@
 #include <format>
 #include <iostream>
+#include "task/external_clock.hpp"
 #include "task/task_base.hpp"
 using namespace ocm;
 
@@ -12,30 +13,20 @@ class Task : public ocm::TaskBase {
   void Run() override { std::cout << std::format("[external_timer_test]{}", this->GetLoopDuration()) << std::endl; }
 };
 
-// 定义一个继承自TaskBase的任务类，用于定时任务
+// 定义一个继承自TaskBase的任务类，用于驱动外部时钟
 class TaskTimer : public ocm::TaskBase {
  public:
-  // 构造函数，初始化任务名称、定时器类型、周期等
-  TaskTimer()
-      : ocm::TaskBase("external_timer_test_timer", ocm::TimerType::INTERNAL_TIMER, 0.0, false, false),
-        sem_("external_timer_test", 0),                       // 创建信号量
-        shm_("external_timer_test", true, sizeof(uint8_t)) {  // 创建共享内存
-    shm_.Lock();                                              // 锁定共享内存
-    *shm_.Get() = 1;                                          // 设置为1毫秒（任务定时器周期）
-    shm_.UnLock();                                            // 解锁共享内存
-  }
+  // 构造函数，初始化任务名称、定时器类型，并创建节拍周期为 1 毫秒的外部时钟
+  TaskTimer() : ocm::TaskBase("external_timer_test_timer", ocm::TimerType::INTERNAL_TIMER, 0.0, false, false), clock_("external_timer_test", 0.001) {}
 
   // 默认析构函数
   ~TaskTimer() = default;
 
-  // 重写Run方法，每次运行时递增信号量
-  void Run() override {
-    sem_.IncrementWhenZero();  // 如果信号量为0，则递增信号量
-  }
+  // 重写Run方法，每次运行时推进一个节拍
+  void Run() override { clock_.Tick(); }
 
  private:
-  ocm::SharedMemorySemaphore sem_;      // 信号量
-  ocm::SharedMemoryData<uint8_t> shm_;  // 共享内存数据
+  ocm::ExternalClock clock_;  // 外部时钟
 };
 
 int main() {
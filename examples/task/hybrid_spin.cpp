@@ -0,0 +1,41 @@
+#include <format>
+#include <iostream>
+#include "common/struct_type.hpp"
+#include "task/task_base.hpp"
+using namespace ocm;
+
+class Task : public ocm::TaskBase {
+ public:
+  // 构造函数，使用先睡眠后自旋的定时器
+  Task(const std::string& name) : ocm::TaskBase(name, ocm::TimerType::HYBRID_SPIN, 0.0, false, false) {}
+
+  // 重写 Run 方法，高频任务中不做输出
+  void Run() override {}
+};
+
+int main() {
+  SystemSetting system_setting;
+  system_setting.priority = 0;        // 设置任务优先级为 0
+  system_setting.cpu_affinity = {0};  // 设置 CPU 亲和性为 CPU 0
+
+  // 以 10kHz 运行，初始自旋余量 30 微秒，并自动校准
+  Task task("hybrid_spin");
+  task.SetPeriod(0.0001);
+  task.SetSpinMargin(0.00003);
+  task.TaskStart(system_setting);
+
+  // 每秒输出一次达到的唤醒抖动与当前的自旋余量
+  for (int i = 0; i < 5; ++i) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    HistogramSummary wake = task.GetWakeLatencySummary();
+    std::cout << std::format("[hybrid_spin] wake latency p50 {} ns, p99 {} ns, max {} ns, spin margin {:.1f} us", wake.p50, wake.p99, wake.max,
+                             task.GetSpinMargin() * 1e6)
+              << std::endl;
+    task.ResetTimingStats();
+  }
+
+  // 销毁任务
+  task.TaskDestroy();
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include <format>
+#include <iostream>
+#include "common/struct_type.hpp"
+#include "task/sim_clock.hpp"
+#include "task/task_base.hpp"
+using namespace ocm;
+
+class Task : public ocm::TaskBase {
+ public:
+  // 构造函数，使用仿真时钟
+  Task(const std::string& name) : ocm::TaskBase(name, ocm::TimerType::SIMULATED, 0.0, false, false), name_(name) {}
+
+  // 重写 Run 方法，统计运行次数，循环持续时间为仿真时间
+  void Run() override { ++count_; }
+
+  // 获取运行次数
+  int64_t GetCount() const { return count_; }
+
+ private:
+  std::string name_;
+  int64_t count_ = 0;
+};
+
+int main() {
+  SystemSetting system_setting;
+  system_setting.priority = 0;        // 设置任务优先级为 0
+  system_setting.cpu_affinity = {0};  // 设置 CPU 亲和性为 CPU 0
+
+  // 1 毫秒与 10 毫秒周期的两个仿真任务
+  Task task_fast("simulated_fast");
+  Task task_slow("simulated_slow");
+  task_fast.SetPeriod(0.001);
+  task_slow.SetPeriod(0.01);
+  task_fast.TaskStart(system_setting);
+  task_slow.TaskStart(system_setting);
+
+  // 以锁步方式尽可能快地运行 10 分钟的仿真时间
+  SimClock& clock = SimClock::getInstance();
+  while (clock.Now() < 600.0) {
+    clock.StepToNext();
+  }
+  std::cout << std::format("[simulated] {} s simulated, fast {} runs ({} ms loop), slow {} runs ({} ms loop)", clock.Now(), task_fast.GetCount(),
+                           task_fast.GetLoopDuration(), task_slow.GetCount(), task_slow.GetLoopDuration())
+            << std::endl;
+
+  // 销毁任务
+  task_fast.TaskDestroy();
+  task_slow.TaskDestroy();
+
+  return 0;
+}
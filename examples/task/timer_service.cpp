@@ -0,0 +1,52 @@
+#include <format>
+#include <iostream>
+#include "common/struct_type.hpp"
+#include "task/task_base.hpp"
+#include "task/timer_service.hpp"
+using namespace ocm;
+
+class Task : public ocm::TaskBase {
+ public:
+  // 构造函数，使用进程内共享的定时器服务
+  Task(const std::string& name) : ocm::TaskBase(name, ocm::TimerType::TIMER_SERVICE, 0.0, false, false), name_(name) {}
+
+  // 重写 Run 方法，输出当前任务的循环持续时间
+  void Run() override { std::cout << std::format("[{}]{}", name_, this->GetLoopDuration()) << std::endl; }
+
+ private:
+  std::string name_;
+};
+
+int main() {
+  // 配置定时器服务：1毫秒节拍，时钟线程运行在 CPU 0
+  SystemSetting clock_setting;
+  clock_setting.priority = 0;
+  clock_setting.cpu_affinity = {0};
+  TimerService::getInstance().Configure(0.001, clock_setting);
+
+  SystemSetting system_setting;
+  system_setting.priority = 0;        // 设置任务优先级为 0
+  system_setting.cpu_affinity = {0};  // 设置 CPU 亲和性为 CPU 0
+
+  // 两个周期相同的任务通过相位错开 50 毫秒，第三个任务周期为 0.5 秒
+  Task task_a("timer_service_a");
+  Task task_b("timer_service_b");
+  Task task_c("timer_service_c");
+  task_a.SetPeriod(0.1);
+  task_b.SetPeriod(0.1);
+  task_b.SetPhase(0.05);
+  task_c.SetPeriod(0.5);
+  task_a.TaskStart(system_setting);
+  task_b.TaskStart(system_setting);
+  task_c.TaskStart(system_setting);
+
+  // 程序运行 2 秒钟
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+
+  // 销毁任务
+  task_a.TaskDestroy();
+  task_b.TaskDestroy();
+  task_c.TaskDestroy();
+
+  return 0;
+}
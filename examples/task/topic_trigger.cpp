@@ -0,0 +1,46 @@
+#include <format>
+#include <iostream>
+#include "ocm/topic_signal.hpp"
+#include "task/task_base.hpp"
+using namespace ocm;
+
+class Task : public ocm::TaskBase {
+ public:
+  // 构造函数，任务由绑定的话题发布触发
+  Task() : ocm::TaskBase("topic_trigger_test", ocm::TimerType::TOPIC_TRIGGER, 0.0, false, false) {}
+
+  // 重写 Run 方法，输出当前任务的循环持续时间
+  void Run() override { std::cout << std::format("[topic_trigger_test]{}", this->GetLoopDuration()) << std::endl; }
+};
+
+int main() {
+  // 创建一个话题触发任务实例，camera 与 lidar 都有新数据时运行，0.5 秒内未凑齐则照常运行
+  Task fusion_task;
+  fusion_task.SetTriggerTopics({"camera", "lidar"}, TriggerPolicy::ALL_OF, 0.5);
+
+  // 设置系统设置，包括任务优先级和 CPU 亲和性
+  SystemSetting system_setting;
+  system_setting.priority = 0;        // 设置任务优先级为 0
+  system_setting.cpu_affinity = {0};  // 设置 CPU 亲和性为 CPU 0
+
+  // 启动任务
+  fusion_task.TaskStart(system_setting);
+
+  // 模拟传感器发布：camera 30 Hz，lidar 10 Hz，最后 1 秒 lidar 停止发布
+  // 实际使用中由 SharedMemoryTopicLcm::Publish 在写入数据后发出通知
+  TopicSignalSlot* camera = TopicSignal::getInstance().GetSlot("camera");
+  TopicSignalSlot* lidar = TopicSignal::getInstance().GetSlot("lidar");
+  for (int i = 0; i < 90; ++i) {
+    std::this_thread::sleep_for(std::chrono::microseconds(33333));
+    TopicSignal::getInstance().Notify(camera);
+    if (i % 3 == 0 && i < 60) {
+      TopicSignal::getInstance().Notify(lidar);
+    }
+  }
+  std::cout << std::format("timeout count: {}", fusion_task.GetMissCount()) << std::endl;
+
+  // 销毁任务
+  fusion_task.TaskDestroy();
+
+  return 0;
+}
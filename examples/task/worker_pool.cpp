@@ -0,0 +1,49 @@
+#include <format>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "common/struct_type.hpp"
+#include "task/task_base.hpp"
+#include "task/worker_pool.hpp"
+using namespace ocm;
+
+class Task : public ocm::TaskBase {
+ public:
+  // 构造函数，非实时任务不创建独立线程，作为作业在共享的工作线程池中运行
+  Task(const std::string& name) : ocm::TaskBase(name, ocm::TimerType::INTERNAL_TIMER, 0.0, false, false, "", false), name_(name) {}
+
+  // 重写 Run 方法，输出当前任务的循环持续时间
+  void Run() override { std::cout << std::format("[{}]{}", name_, this->GetLoopDuration()) << std::endl; }
+
+ private:
+  std::string name_;
+};
+
+int main() {
+  // 配置工作线程池：2 个工作线程，运行在 CPU 0
+  SystemSetting worker_setting;
+  worker_setting.priority = 0;
+  worker_setting.cpu_affinity = {0};
+  WorkerPool::getInstance().Configure(2, worker_setting);
+
+  SystemSetting system_setting;
+  system_setting.priority = 0;
+
+  // 8 个 10~50 Hz 的任务共享 2 个工作线程，按截止时间先后运行
+  std::vector<std::unique_ptr<Task>> task_list;
+  for (int i = 0; i < 8; ++i) {
+    task_list.emplace_back(std::make_unique<Task>(std::format("worker_task_{}", i)));
+    task_list.back()->SetPeriod(i % 2 == 0 ? 0.02 : 0.1);
+    task_list.back()->TaskStart(system_setting);
+  }
+
+  // 程序运行 2 秒钟
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+
+  // 销毁任务
+  for (auto& task : task_list) {
+    task->TaskDestroy();
+  }
+
+  return 0;
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "common/struct_type.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+#include "monitor/monitor.hpp"
+#include "ocm/shard_memory_data.hpp"
+#include "ocm/shared_memory_semaphore.hpp"
+#include "ocm/topic_signal.hpp"
+#include "task/task_base.hpp"
+
+namespace ocm {
+
+/**
+ * @brief 桥接的单个共享内存话题配置。
+ */
+struct LcmBridgeTopic {
+  /** @brief 共享内存话题的信号量名称。 */
+  std::string topic_name;
+
+  /** @brief 共享内存段名称。 */
+  std::string shm_name;
+
+  /** @brief LCM通道名称。 */
+  std::string channel;
+
+  /** @brief 最大转发频率（Hz），0表示不限频。仅对共享内存到LCM方向生效。 */
+  double max_rate = 0.0;
+};
+
+/**
+ * @brief 配置LcmBridge的设置。
+ */
+struct LcmBridgeConfig {
+  /** @brief LCM多播组地址。 */
+  std::string multicast_ip = "239.255.76.67";
+
+  /** @brief LCM多播端口。 */
+  int port = 7667;
+
+  /** @brief 多播数据包的生存时间（TTL）值。 */
+  int ttl = 0;
+
+  /** @brief 收发多播所使用的本地网卡地址，回环测试时设为"127.0.0.1"。 */
+  std::string interface_ip = "0.0.0.0";
+
+  /** @brief 桥接任务的轮询周期，以秒为单位。 */
+  double period = 0.001;
+
+  /** @brief 单次`sendmmsg`/`recvmmsg`系统调用批量处理的最大报文数量。 */
+  size_t batch_size = 32;
+
+  /** @brief 启用所有优先级设置的标志。 */
+  bool all_priority_enable = false;
+
+  /** @brief 启用所有CPU亲和性设置的标志。 */
+  bool all_cpu_affinity_enable = false;
+
+  /** @brief 与实时调度相关的系统设置。 */
+  SystemSetting system_setting;
+
+  /** @brief 由共享内存转发到LCM的话题列表。 */
+  std::vector<LcmBridgeTopic> outbound;
+
+  /** @brief 由LCM转发到共享内存的话题列表。 */
+  std::vector<LcmBridgeTopic> inbound;
+};
+
+/**
+ * @class LcmBridge
+ * @brief 共享内存话题与LCM UDP多播之间的双向桥接任务。
+ *
+ * 每个周期先非阻塞地批量接收LCM报文并写入对应的共享内存话题，
+ * 再检查所有外发话题的信号量，将就绪且未超出限频的负载原样（不重新编码）打包为LCM短报文，
+ * 通过`sendmmsg`在一次系统调用中批量发送。
+ *
+ * @note 共享内存中的负载已是LCM编码（含类型哈希），因此可被标准LCM订阅者直接解码。
+ * @note 每个数据报仍只携带一条LCM短报文，以保持与标准LCM接收端的兼容，超过短报文上限的消息将被丢弃。
+ */
+class LcmBridge : public TaskBase {
+ public:
+  /**
+   * @brief 构造并启动桥接任务。
+   *
+   * 创建收发套接字、加入多播组并按配置启动任务线程。
+   *
+   * @param config 桥接配置。
+   *
+   * @throws std::runtime_error 如果套接字创建或多播配置失败。
+   */
+  LcmBridge(const LcmBridgeConfig& config);
+
+  /**
+   * @brief 析构函数，关闭套接字。
+   *
+   * @note 调用者需在析构前调用`TaskDestroy()`结束任务线程。
+   */
+  ~LcmBridge();
+
+  /**
+   * @brief 执行一次桥接：接收入站报文并批量发送出站报文。
+   */
+  void Run() override;
+
+  /**
+   * @brief 获取已发送的LCM报文数量。
+   */
+  uint64_t GetSendCount() const;
+
+  /**
+   * @brief 获取已写入共享内存的LCM报文数量。
+   */
+  uint64_t GetReceiveCount() const;
+
+  /**
+   * @brief 获取因限频、超长或格式错误被丢弃的报文数量。
+   */
+  uint64_t GetDropCount() const;
+
+ private:
+  /**
+   * @brief 出站话题的运行时状态。
+   */
+  struct OutboundTopic {
+    LcmBridgeTopic config;                          /**< 话题配置 */
+    std::unique_ptr<SharedMemorySemaphore> sem;     /**< 话题信号量 */
+    std::unique_ptr<SharedMemoryData<uint8_t>> shm; /**< 话题共享内存，首次收到通知时打开 */
+    std::vector<uint8_t> datagram;                  /**< 预分配的数据报缓冲区（LCM头 + 通道名 + 负载） */
+    size_t header_size = 0;                         /**< LCM头与通道名的字节数 */
+    int64_t min_interval_ns = 0;                    /**< 由限频换算的最小发送间隔 */
+    int64_t last_send_ns = 0;                       /**< 上次发送时间 */
+    bool pending = false;                           /**< 是否存在待发送的新数据 */
+  };
+
+  /**
+   * @brief 入站话题的运行时状态。
+   */
+  struct InboundTopic {
+    LcmBridgeTopic config;                          /**< 话题配置 */
+    std::unique_ptr<SharedMemorySemaphore> sem;     /**< 话题信号量 */
+    std::unique_ptr<SharedMemoryData<uint8_t>> shm; /**< 话题共享内存，首次收到报文时按负载大小创建 */
+    MonitorTopicSlot* monitor = nullptr;            /**< 话题监控槽位 */
+    TopicSignalSlot* signal = nullptr;              /**< 话题通知槽位，用于唤醒`TOPIC_TRIGGER`任务 */
+  };
+
+  /**
+   * @brief 创建并配置发送与接收套接字。
+   */
+  void OpenSocket();
+
+  /**
+   * @brief 非阻塞地批量接收LCM报文并写入共享内存。
+   */
+  void ReceiveInbound();
+
+  /**
+   * @brief 收集就绪的出站话题并批量发送。
+   *
+   * @param now_ns 当前单调时钟时间，以纳秒为单位。
+   */
+  void SendOutbound(int64_t now_ns);
+
+  /**
+   * @brief 将已收集的出站报文通过`sendmmsg`发送出去。
+   *
+   * @param count 待发送的报文数量。
+   */
+  void FlushBatch(size_t count);
+
+  LcmBridgeConfig config_;                                /**< 桥接配置 */
+  int send_fd_;                                           /**< 发送套接字 */
+  int recv_fd_;                                           /**< 接收套接字 */
+  uint16_t send_port_;                                    /**< 发送套接字的本地端口，用于过滤自身回环报文 */
+  in_addr send_source_;                                   /**< 发送报文的本地源地址，与端口一起用于过滤自身回环报文 */
+  sockaddr_in dest_addr_;                                 /**< 多播目的地址 */
+  uint32_t sequence_;                                     /**< LCM报文序号 */
+  std::vector<OutboundTopic> outbound_;                   /**< 出站话题 */
+  std::vector<InboundTopic> inbound_;                     /**< 入站话题 */
+  std::unordered_map<std::string, size_t> inbound_index_; /**< 通道名到入站话题下标的映射 */
+  std::vector<mmsghdr> send_msgs_;                        /**< 预分配的发送报文头 */
+  std::vector<iovec> send_iovs_;                          /**< 预分配的发送缓冲区描述 */
+  std::vector<std::vector<uint8_t>> recv_buffers_;        /**< 预分配的接收缓冲区 */
+  std::vector<mmsghdr> recv_msgs_;                        /**< 预分配的接收报文头 */
+  std::vector<iovec> recv_iovs_;                          /**< 预分配的接收缓冲区描述 */
+  std::vector<sockaddr_in> recv_addrs_;                   /**< 预分配的接收源地址 */
+  std::atomic<uint64_t> send_count_;                      /**< 已发送报文计数 */
+  std::atomic<uint64_t> receive_count_;                   /**< 已接收报文计数 */
+  std::atomic<uint64_t> drop_count_;                      /**< 丢弃报文计数 */
+  std::shared_ptr<spdlog::logger> logger_;                /**< 日志记录器 */
+};
+
+}  // namespace ocm
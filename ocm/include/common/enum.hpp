@@ -1,6 +1,7 @@
 // Start of Selection
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
@@ -17,6 +18,16 @@ enum class NodeState : uint8_t {
   STANDBY   /**< 待命状态 */
 };
 
+/**
+ * @enum NodeCheckState
+ * @brief 表示切换期间节点进入或退出检查的状态。
+ */
+enum class NodeCheckState : uint8_t {
+  IDLE = 0, /**< 没有进行中的检查，或上一次检查未通过 */
+  PENDING,  /**< 异步检查进行中 */
+  PASSED    /**< 检查已通过 */
+};
+
 /**
  * @enum TaskState
  * @brief 表示任务的状态。
@@ -27,6 +38,28 @@ enum class TaskState : uint8_t {
   STANDBY   /**< 待命状态 */
 };
 
+/**
+ * @enum PortDirection
+ * @brief 表示节点数据端口的方向。
+ */
+enum class PortDirection : uint8_t {
+  INPUT = 0, /**< 输入端口 */
+  OUTPUT     /**< 输出端口 */
+};
+
+/**
+ * @enum NodePhase
+ * @brief 表示节点在任务周期中被调用的阶段，用于节点耗时统计。
+ */
+enum class NodePhase : uint8_t {
+  CONSTRUCT = 0, /**< 构造 */
+  INIT,          /**< 初始化 */
+  EXECUTE,       /**< 执行 */
+  OUTPUT         /**< 输出 */
+};
+
+constexpr size_t kNodePhaseNum = 4; /**< 节点阶段数量 */
+
 /**
  * @enum TimerType
  * @brief 表示定时器的类型。
@@ -34,7 +67,11 @@ enum class TaskState : uint8_t {
 enum class TimerType : uint8_t {
   INTERNAL_TIMER = 0, /**< 内部定时器 */
   EXTERNAL_TIMER,     /**< 外部定时器 */
-  TRIGGER             /**< 触发器 */
+  TRIGGER,            /**< 触发器 */
+  TIMER_SERVICE,      /**< 进程内共享的分层时间轮定时器服务 */
+  HYBRID_SPIN,        /**< 先睡眠至截止时间前的余量，再自旋等待到截止时间的内部定时器 */
+  SIMULATED,          /**< 由`SimClock`以锁步方式推进的仿真时间 */
+  TOPIC_TRIGGER       /**< 由绑定的共享内存话题发布触发 */
 };
 
 /**
@@ -46,6 +83,76 @@ const std::unordered_map<std::string, TimerType> timer_type_map = {
     {"INTERNAL_TIMER", TimerType::INTERNAL_TIMER},
     {"EXTERNAL_TIMER", TimerType::EXTERNAL_TIMER},
     {"TRIGGER", TimerType::TRIGGER},
+    {"TIMER_SERVICE", TimerType::TIMER_SERVICE},
+    {"HYBRID_SPIN", TimerType::HYBRID_SPIN},
+    {"SIMULATED", TimerType::SIMULATED},
+    {"TOPIC_TRIGGER", TimerType::TOPIC_TRIGGER},
+};
+
+/**
+ * @enum OverrunPolicy
+ * @brief 表示任务错过截止时间后的处理策略。
+ */
+enum class OverrunPolicy : uint8_t {
+  CATCH_UP = 0, /**< 追赶：立即连续运行，直到追上错过的周期 */
+  SKIP,         /**< 跳过：丢弃错过的周期，并重新对齐到原有的周期网格 */
+  RESTART       /**< 重启：以当前时间为起点重新开始计时 */
+};
+
+/**
+ * @brief 将超限策略的字符串表示映射到对应的 `OverrunPolicy` 枚举值。
+ */
+const std::unordered_map<std::string, OverrunPolicy> overrun_policy_map = {
+    {"CATCH_UP", OverrunPolicy::CATCH_UP},
+    {"SKIP", OverrunPolicy::SKIP},
+    {"RESTART", OverrunPolicy::RESTART},
+};
+
+/**
+ * @enum TriggerPolicy
+ * @brief 表示`TOPIC_TRIGGER`任务绑定多个话题时的触发策略。
+ */
+enum class TriggerPolicy : uint8_t {
+  ANY_OF = 0, /**< 任意一个话题有新数据即触发 */
+  ALL_OF      /**< 所有话题都有新数据才触发 */
+};
+
+/**
+ * @brief 将触发策略的字符串表示映射到对应的 `TriggerPolicy` 枚举值。
+ */
+const std::unordered_map<std::string, TriggerPolicy> trigger_policy_map = {
+    {"ANY_OF", TriggerPolicy::ANY_OF},
+    {"ALL_OF", TriggerPolicy::ALL_OF},
+};
+
+/**
+ * @enum SchedPolicy
+ * @brief 表示任务线程的调度策略。
+ */
+enum class SchedPolicy : uint8_t {
+  FIFO = 0, /**< 固定优先级调度，使用`priority` */
+  DEADLINE  /**< 截止时间调度，由内核CBS按`sched_runtime`/`sched_deadline`/`sched_period`限制CPU预算 */
+};
+
+/**
+ * @brief 将调度策略的字符串表示映射到对应的 `SchedPolicy` 枚举值。
+ */
+const std::unordered_map<std::string, SchedPolicy> sched_policy_map = {
+    {"FIFO", SchedPolicy::FIFO},
+    {"DEADLINE", SchedPolicy::DEADLINE},
+};
+
+/**
+ * @enum TraceCategory
+ * @brief 表示跟踪事件的类别。
+ */
+enum class TraceCategory : uint8_t {
+  TASK = 0,  /**< 任务被唤醒后的一次运行 */
+  NODE,      /**< 节点的执行与输出 */
+  EXECUTER,  /**< 执行器的任务组切换 */
+  PUBLISH,   /**< 共享内存话题的发布 */
+  SUBSCRIBE, /**< 共享内存话题的订阅 */
+  SEMAPHORE  /**< 共享内存信号量的等待 */
 };
 
 /**
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+
+namespace ocm {
+
+/**
+ * @brief 在futex字上等待，直到其值不再等于`expected`、被唤醒或超时。
+ *
+ * @param addr futex字地址。
+ * @param expected 期望值，若当前值不等于该值则立即返回。
+ * @param abs_timeout 基于`CLOCK_MONOTONIC`的绝对超时时间，为`nullptr`时无限等待。
+ * @param shared 是否为跨进程（位于共享内存中）的futex字。
+ * @param bitset 等待的位集合，只有位集合与之相交的唤醒才会唤醒该线程，不能为0。
+ * @return 被唤醒或值已改变时返回`true`，超时返回`false`。
+ */
+inline bool FutexWait(std::atomic<uint32_t>* addr, uint32_t expected, const timespec* abs_timeout = nullptr, bool shared = false,
+                      uint32_t bitset = FUTEX_BITSET_MATCH_ANY) {
+  int op = FUTEX_WAIT_BITSET | (shared ? 0 : FUTEX_PRIVATE_FLAG);
+  long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), op, expected, abs_timeout, nullptr, bitset);
+  return !(ret == -1 && errno == ETIMEDOUT);
+}
+
+/**
+ * @brief 唤醒在futex字上等待的线程。
+ *
+ * @param addr futex字地址。
+ * @param count 最多唤醒的线程数量，默认唤醒全部。
+ * @param shared 是否为跨进程（位于共享内存中）的futex字。
+ * @param bitset 唤醒的位集合，只唤醒等待位集合与之相交的线程，默认唤醒全部。
+ * @return 实际唤醒的线程数量。
+ */
+inline int FutexWake(std::atomic<uint32_t>* addr, int count = INT_MAX, bool shared = false, uint32_t bitset = FUTEX_BITSET_MATCH_ANY) {
+  int op = FUTEX_WAKE_BITSET | (shared ? 0 : FUTEX_PRIVATE_FLAG);
+  long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), op, count, nullptr, nullptr, bitset);
+  return ret < 0 ? 0 : static_cast<int>(ret);
+}
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+
+}  // namespace ocm
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace ocm {
+
+/**
+ * @brief 直方图的统计摘要，所有数值以纳秒为单位。
+ */
+struct HistogramSummary {
+  uint64_t count = 0; /**< 样本数量 */
+  int64_t min = 0;    /**< 最小值 */
+  int64_t max = 0;    /**< 最大值 */
+  double mean = 0.0;  /**< 平均值 */
+  int64_t p50 = 0;    /**< 50分位数 */
+  int64_t p99 = 0;    /**< 99分位数 */
+  int64_t p999 = 0;   /**< 99.9分位数 */
+};
+
+/**
+ * @brief 无锁的对数线性直方图。
+ *
+ * 每个2的幂区间再线性划分为16个子桶，相对误差不超过1/16，覆盖0到约68秒（2^36纳秒）的取值，超出部分计入最后一个桶。
+ * 仅允许单个线程调用`Record`，其它线程可随时读取；全部成员均为原子变量且无指针，可直接放入共享内存。
+ */
+struct LatencyHistogram {
+  static constexpr int kSubBucketBits = 4;                                           /**< 子桶数量的位数 */
+  static constexpr int kSubBucketNum = 1 << kSubBucketBits;                          /**< 每个2的幂区间的子桶数量 */
+  static constexpr int kMaxBits = 36;                                                /**< 可区分的最大取值位数 */
+  static constexpr int kBucketNum = (kMaxBits - kSubBucketBits + 1) * kSubBucketNum; /**< 桶数量 */
+
+  std::atomic<uint64_t> count;               /**< 样本数量 */
+  std::atomic<int64_t> sum;                  /**< 样本总和 */
+  std::atomic<int64_t> min;                  /**< 最小值 */
+  std::atomic<int64_t> max;                  /**< 最大值 */
+  std::atomic<uint64_t> buckets[kBucketNum]; /**< 各桶的样本数量 */
+
+  /**
+   * @brief 记录一个样本。
+   *
+   * 单写者下只使用普通的原子读写，不产生带锁前缀的指令。
+   *
+   * @param value 样本值（纳秒），负值按0记录。
+   */
+  void Record(int64_t value) {
+    if (value < 0) {
+      value = 0;
+    }
+    auto& bucket = buckets[BucketIndex(static_cast<uint64_t>(value))];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    if (value < min.load(std::memory_order_relaxed)) {
+      min.store(value, std::memory_order_relaxed);
+    }
+    if (value > max.load(std::memory_order_relaxed)) {
+      max.store(value, std::memory_order_relaxed);
+    }
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief 清空所有样本。
+   *
+   * 与`Record`并发调用时可能丢失少量样本。
+   */
+  void Reset();
+
+  /**
+   * @brief 计算统计摘要。
+   *
+   * @return 样本数量、最小值、最大值、平均值及p50/p99/p99.9，分位数取所在桶的上界。
+   */
+  HistogramSummary Summary() const;
+
+  /**
+   * @brief 计算样本值所在的桶下标。
+   */
+  static int BucketIndex(uint64_t value) {
+    if (value < static_cast<uint64_t>(kSubBucketNum)) {
+      return static_cast<int>(value);  // 小值线性存储，精确无误差
+    }
+    int msb = 63 - __builtin_clzll(value);
+    if (msb >= kMaxBits) {
+      return kBucketNum - 1;
+    }
+    int shift = msb - kSubBucketBits;
+    return (shift + 1) * kSubBucketNum + static_cast<int>((value >> shift) - kSubBucketNum);
+  }
+
+  /**
+   * @brief 计算桶所覆盖取值的上界。
+   */
+  static int64_t BucketUpperBound(int index);
+};
+
+}  // namespace ocm
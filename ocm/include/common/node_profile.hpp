@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "common/enum.hpp"
+#include "common/histogram.hpp"
+
+namespace ocm {
+
+/**
+ * @brief 节点某一阶段的最长耗时记录。
+ */
+struct NodeWorstCase {
+  int64_t duration_ns = 0; /**< 最长耗时，以纳秒为单位 */
+  int64_t time_ns = 0;     /**< 最长耗时开始的时刻，`CLOCK_MONOTONIC`纳秒，尚无记录时为0 */
+};
+
+/**
+ * @brief 节点各阶段的耗时统计。
+ *
+ * 每个阶段（构造、初始化、执行、输出）一个耗时直方图与一条带时间戳的最长耗时记录。
+ * 与`LatencyHistogram`相同，仅允许单个线程记录，其它线程可随时读取；全部成员均为原子变量且无指针，可直接放入共享内存。
+ */
+struct NodeProfile {
+  LatencyHistogram time[kNodePhaseNum];              /**< 各阶段的耗时直方图 */
+  std::atomic<int64_t> worst_ns[kNodePhaseNum];      /**< 各阶段的最长耗时 */
+  std::atomic<int64_t> worst_time_ns[kNodePhaseNum]; /**< 各阶段最长耗时开始的时刻 */
+
+  /**
+   * @brief 记录一次阶段耗时。
+   *
+   * @param phase 节点阶段。
+   * @param start_ns 阶段开始时刻，`CLOCK_MONOTONIC`纳秒。
+   * @param end_ns 阶段结束时刻，`CLOCK_MONOTONIC`纳秒。
+   */
+  void Record(NodePhase phase, int64_t start_ns, int64_t end_ns) {
+    int index = static_cast<int>(phase);
+    int64_t duration = end_ns - start_ns;
+    time[index].Record(duration);
+    if (duration > worst_ns[index].load(std::memory_order_relaxed)) {
+      worst_time_ns[index].store(start_ns, std::memory_order_relaxed);
+      worst_ns[index].store(duration, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief 清空所有阶段的统计。
+   */
+  void Reset();
+
+  /**
+   * @brief 计算阶段耗时的统计摘要。
+   *
+   * @param phase 节点阶段。
+   * @return 耗时的统计摘要，以纳秒为单位。
+   */
+  HistogramSummary Summary(NodePhase phase) const;
+
+  /**
+   * @brief 获取阶段的最长耗时记录。
+   *
+   * 与`Record`并发读取时，耗时与时间戳可能分别来自相邻的两次更新。
+   *
+   * @param phase 节点阶段。
+   * @return 最长耗时记录。
+   */
+  NodeWorstCase Worst(NodePhase phase) const;
+};
+
+}  // namespace ocm
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace ocm {
+
+/**
+ * @class StateNotifier
+ * @brief 进程内任务与节点状态变化的可等待通知。
+ *
+ * 任务状态（`TaskState`）或节点状态（`NodeState`）发生变化时递增变更序号，并在有等待者时通过futex唤醒。
+ * 等待者先读取序号再检查条件，条件不满足时等待序号变化，因此不会错过检查之后发生的变化。
+ * 没有等待者时通知只是一次原子递增，不进入内核。
+ */
+class StateNotifier {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  StateNotifier(const StateNotifier&) = delete;
+  StateNotifier& operator=(const StateNotifier&) = delete;
+
+  /**
+   * @brief 获取StateNotifier的单例实例。
+   * @return 单例实例的引用。
+   */
+  static StateNotifier& getInstance();
+
+  /**
+   * @brief 通知状态已变化，唤醒所有等待者。
+   */
+  void Notify();
+
+  /**
+   * @brief 获取当前的变更序号。
+   *
+   * @return 变更序号。
+   */
+  uint32_t GetSeq() const;
+
+  /**
+   * @brief 等待变更序号不再等于`seq`。
+   *
+   * @param seq 检查条件前读取的变更序号。
+   * @param timeout 超时时间，以秒为单位，小于等于0时无限等待。
+   * @return 序号已变化返回`true`，超时返回`false`。
+   */
+  bool WaitChange(uint32_t seq, double timeout = 0);
+
+  /**
+   * @brief 等待条件满足。
+   *
+   * 每次状态变化后重新检查条件。
+   *
+   * @param ready 等待条件。
+   * @param timeout 超时时间，以秒为单位，小于等于0时无限等待。
+   * @return 条件满足返回`true`，超时返回`false`。
+   */
+  bool WaitFor(const std::function<bool()>& ready, double timeout = 0);
+
+ private:
+  /**
+   * @brief 私有构造函数。
+   */
+  StateNotifier();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~StateNotifier() = default;
+
+  std::atomic<uint32_t> seq_;     /**< 变更序号，同时作为futex字 */
+  std::atomic<uint32_t> waiters_; /**< 正在等待的线程数量，为0时通知跳过唤醒系统调用 */
+};
+
+}  // namespace ocm
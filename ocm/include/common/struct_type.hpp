@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -6,37 +8,55 @@
 
 namespace ocm {
 
+using NodeId = uint32_t;                                               /**< 节点在`NodeMap`中的稠密整数ID，按登记顺序从0开始分配。 */
+constexpr NodeId kInvalidNodeId = std::numeric_limits<NodeId>::max(); /**< 尚未解析的节点ID。 */
+
 /**
  * @struct NodeConfig
  * @brief 节点的配置设置。
  *
- * 该结构体包含单个节点的配置详情，包括其名称和输出启用状态。
+ * 该结构体包含单个节点的配置详情，包括其名称、输出启用状态、数据依赖和分频设置。
  */
 struct NodeConfig {
-  std::string node_name; /**< 节点的名称标识符。 */
-  bool output_enable;    /**< 标志，指示节点的输出是否被启用。 */
+  std::string node_name;           /**< 节点的名称标识符。 */
+  bool output_enable;              /**< 标志，指示节点的输出是否被启用。 */
+  std::vector<std::string> depend; /**< 同一任务内该节点依赖的节点名称列表，仅在任务启用并行执行时生效。 */
+  int rate_divisor = 1;            /**< 分频系数，节点每`rate_divisor`个任务周期运行一次，1表示每个周期都运行。 */
+  int rate_phase = -1;             /**< 节点在第`tick % rate_divisor == rate_phase`个周期运行，-1表示由任务自动分配以均衡各周期的负载。 */
+  NodeId node_id = kInvalidNodeId; /**< 节点ID，由执行器在创建任务时解析。 */
 };
 
 /**
  * @struct TimerSetting
  * @brief 定时器的配置设置。
  *
- * 该结构体定义了定时器的设置，包括其类型和周期时长。
+ * 该结构体定义了定时器的设置，包括其类型、周期时长、相位偏移和错过截止时间后的处理策略。
  */
 struct TimerSetting {
-  TimerType timer_type; /**< 定时器的类型，由 `TimerType` 枚举定义。 */
-  double period;        /**< 定时器的周期，单位为秒。 */
+  TimerType timer_type;                                   /**< 定时器的类型，由 `TimerType` 枚举定义。 */
+  double period;                                          /**< 定时器的周期，单位为秒。 */
+  OverrunPolicy overrun_policy = OverrunPolicy::CATCH_UP; /**< 错过截止时间后的处理策略。 */
+  double phase = 0;                                       /**< 周期内的相位偏移，单位为秒，同周期的任务据此错开唤醒。 */
+  double spin_margin = 0;                                 /**< `HYBRID_SPIN`定时器的初始自旋余量，单位为秒，0表示使用默认值。 */
+  std::string clock_name;                                 /**< `EXTERNAL_TIMER`定时器订阅的外部时钟段名称，为空时使用任务名称。 */
+  std::vector<std::string> trigger_topics;                /**< `TOPIC_TRIGGER`定时器绑定的话题名称列表。 */
+  TriggerPolicy trigger_policy = TriggerPolicy::ANY_OF;   /**< `TOPIC_TRIGGER`定时器绑定多个话题时的触发策略。 */
+  double trigger_timeout = 0;                             /**< `TOPIC_TRIGGER`定时器的超时时间，单位为秒，超时未触发时照常运行，0表示无限等待。 */
 };
 
 /**
  * @struct SystemSetting
  * @brief 系统配置设置。
  *
- * 该结构体包含与系统相关的设置，如优先级和CPU亲和性。
+ * 该结构体包含与系统相关的设置，如优先级、CPU亲和性和截止时间调度参数。
  */
 struct SystemSetting {
-  int priority;                  /**< 系统的优先级级别。 */
-  std::vector<int> cpu_affinity; /**< 系统所关联的CPU核心列表。 */
+  int priority;                                 /**< 系统的优先级级别。 */
+  std::vector<int> cpu_affinity;                /**< 系统所关联的CPU核心列表。 */
+  SchedPolicy sched_policy = SchedPolicy::FIFO; /**< 调度策略。 */
+  double sched_runtime = 0;                     /**< 截止时间调度每周期的运行预算，以秒为单位。 */
+  double sched_deadline = 0;                    /**< 截止时间调度的相对截止时间，以秒为单位。 */
+  double sched_period = 0;                      /**< 截止时间调度的周期，以秒为单位。 */
 };
 
 /**
@@ -48,6 +68,7 @@ struct SystemSetting {
 struct LaunchSetting {
   std::vector<std::string> pre_node; /**< 启动任务前需初始化的节点名称列表。 */
   double delay;                      /**< 启动任务前的延迟时间（秒）。 */
+  std::vector<NodeId> pre_node_id;   /**< 前置节点ID列表，由执行器在创建任务时解析。 */
 };
 
 /**
@@ -62,6 +83,9 @@ struct TaskSetting {
   TimerSetting timer_setting;        /**< 任务的定时器设置。 */
   SystemSetting system_setting;      /**< 任务的系统设置。 */
   LaunchSetting launch_setting;      /**< 任务的启动设置。 */
+  bool real_time = true;             /**< 是否为实时任务，非实时任务不独占线程，作为作业在共享的工作线程池中运行。 */
+  bool parallel_enable = false;      /**< 是否按节点依赖图并行执行，辅助线程绑定到`cpu_affinity`中除第一个核心外的核心。 */
+  bool profile_enable = false;       /**< 是否统计每个节点各阶段的耗时并导出到共享内存监控段。 */
 };
 
 /**
@@ -74,6 +98,8 @@ struct GroupTaskSetting {
   std::string task_name;                    /**< 组任务的名称标识符。 */
   std::vector<std::string> force_init_node; /**< 组任务需强制初始化的节点名称列表。 */
   std::vector<std::string> pre_node;        /**< 启动组任务前需初始化的节点名称列表。 */
+  std::vector<NodeId> force_init_node_id;   /**< 强制初始化节点ID列表，由执行器在创建任务时解析。 */
+  std::vector<NodeId> pre_node_id;          /**< 前置节点ID列表，由执行器在创建任务时解析。 */
 };
 
 /**
@@ -105,24 +131,42 @@ struct TaskList {
  * 该结构体定义了配置执行器所需的设置，包括包名称、定时器设置、系统设置以及优先级和CPU亲和性的标志。
  */
 struct ExecuterSetting {
-  std::string package_name;          /**< 与执行器关联的包名称。 */
-  TimerSetting timer_setting;        /**< 执行器的定时器设置。 */
-  SystemSetting system_setting;      /**< 执行器的系统设置。 */
-  SystemSetting idle_system_setting; /**< 执行器空闲时的系统设置。 */
-  bool all_priority_enable;          /**< 标志，指示是否启用所有优先级。 */
-  bool all_cpu_affinity_enable;      /**< 标志，指示是否启用所有CPU亲和性。 */
+  std::string package_name;               /**< 与执行器关联的包名称。 */
+  TimerSetting timer_setting;             /**< 执行器的定时器设置。 */
+  SystemSetting system_setting;           /**< 执行器的系统设置。 */
+  SystemSetting idle_system_setting;      /**< 执行器空闲时的系统设置。 */
+  bool all_priority_enable;               /**< 标志，指示是否启用所有优先级。 */
+  bool all_cpu_affinity_enable;           /**< 标志，指示是否启用所有CPU亲和性。 */
+  bool auto_phase_enable = false;         /**< 标志，指示是否根据实测运行时间为共享CPU的同周期任务自动分配相位。 */
+  int worker_num = 2;                     /**< 运行非实时任务的工作线程数量。 */
+  bool prewarm_enable = false;            /**< 标志，指示是否在创建任务后于后台线程中预先构造所有排他性任务组的节点。 */
+  bool overlap_transition_enable = false; /**< 标志，指示任务组切换是否先启动不冲突的目标任务再停止当前任务。 */
+  double timer_service_tick = 0.001;      /**< 时间轮定时器服务的节拍周期，以秒为单位，`TIMER_SERVICE`任务的周期与相位应为其整数倍。 */
+  int timer_service_priority = 0;         /**< 时间轮时钟线程的实时优先级，为0时使用普通调度。 */
+};
+
+/**
+ * @struct PortConnection
+ * @brief 节点数据端口之间的连接。
+ *
+ * 端口以`节点名称.端口名称`的形式指定。
+ */
+struct PortConnection {
+  std::string output; /**< 输出端口。 */
+  std::string input;  /**< 输入端口。 */
 };
 
 /**
  * @struct ExecuterConfig
  * @brief 执行器的全面配置。
  *
- * 该结构体封装了执行器的完整配置，包括执行器设置、任务列表和独占任务组。
+ * 该结构体封装了执行器的完整配置，包括执行器设置、任务列表、独占任务组和节点端口连接。
  */
 struct ExecuterConfig {
   ExecuterSetting executer_setting;                                   /**< 执行器的设置。 */
   TaskList task_list;                                                 /**< 按组类型分类的任务列表。 */
   std::unordered_map<std::string, GroupSetting> exclusive_task_group; /**< 组名称与其对应的独占任务组设置的映射。 */
+  std::vector<PortConnection> port_connection;                        /**< 节点数据端口之间的连接。 */
 };
 
 }  // namespace ocm
\ No newline at end of file
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <log_anywhere/log_anywhere.hpp>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include "common/struct_type.hpp"
 #include "node/node_map.hpp"
 #include "ocm/atomic_ptr.hpp"
@@ -33,17 +40,19 @@ class Executer : public TaskBase {
   Executer(const ExecuterConfig& executer_config, const std::shared_ptr<NodeMap>& node_map, const std::string& desired_group_topic_name);
 
   /**
-   * @brief 默认析构函数。
+   * @brief 析构函数。
    *
-   * 清理 Executer 使用的资源。
+   * 停止预热线程并清理 Executer 使用的资源。
    */
-  ~Executer() = default;
+  ~Executer();
 
   /**
    * @brief 根据配置为常驻和待命组创建任务。
    *
-   * 从 NodeMap 中检索节点指针，并为配置中的每个任务初始化 Task 实例。
-   * 同时填充排他性任务组集合。
+   * 先将配置中的节点名称解析为节点ID，再按ID从 NodeMap 中检索节点指针，并为配置中的每个任务初始化 Task 实例。
+   * 同时为排他性任务组之间的切换预计算切换计划。
+   *
+   * @throws std::runtime_error 如果配置中的节点不存在。
    */
   void CreateTask();
 
@@ -68,21 +77,89 @@ class Executer : public TaskBase {
    */
   void ExitAllTask();
 
+  /**
+   * @brief 在后台线程中预热排他性任务组，提前构造该组中尚未构造的节点。
+   *
+   * 节点构造通常包含加载模型、分配内存等耗时操作，预热后切换到该组时只需执行有界耗时的`Init`。
+   * 预热线程使用普通调度且不阻塞调用者；任务线程与预热线程同时构造同一节点时只构造一次。
+   * 设置`prewarm_enable`后，`CreateTask`会预热所有排他性任务组。
+   *
+   * @param group_name 排他性任务组名称。
+   * @return 任务组存在且预热线程未停止时返回`true`，需在`CreateTask`之后调用。
+   */
+  bool PrewarmGroup(const std::string& group_name);
+
  private:
+  /**
+   * @brief 处理期望组话题的一次发布，将组名换算为任务组下标。
+   *
+   * 不是排他性任务组时记录错误，期望组下标保持不变。
+   *
+   * @param desired_group 期望组名称。
+   */
+  void UpdateDesiredGroup(const std::string& desired_group);
+
   /**
    * @brief 检查是否需要在任务组之间进行切换。
    *
-   * 如果需要切换，它将准备必要的集合和标志以处理切换。
+   * 比较期望组与当前组的下标，需要切换时取出预计算的切换计划并设置切换标志。
    */
   void TransitionCheck();
 
   /**
    * @brief 处理任务组之间的切换。
    *
-   * 停止当前任务，启动目标任务，并更新当前任务组。
+   * 先在一个执行器周期内等待退出节点与进入节点的检查通过，通过后在同一周期内停止当前任务，启动目标任务，并更新当前任务组。
    */
   void Transition();
 
+  /**
+   * @brief 检查切换计划中的退出节点与进入节点，未完成的节点发起异步检查。
+   *
+   * @return 所有退出节点与进入节点的检查都已通过返回`true`。
+   */
+  bool CheckTransitionNode();
+
+  /**
+   * @brief 为共享CPU的同周期任务自动分配相位。
+   *
+   * 将绑定到相同CPU且周期相同的运行中任务按优先级从高到低排列，依次占用各自实测运行耗时的p99，
+   * 剩余时间平均分配为任务之间的间隔；总运行耗时超过周期时按比例压缩，尚无样本时在周期内均匀分布。
+   * 同时按节点实测执行耗时重新均衡各任务内分频节点的相位。
+   */
+  void AssignPhase();
+
+  /**
+   * @brief 按配置连接节点的数据端口。
+   *
+   * 端口以`节点名称.端口名称`的形式指定，在任务创建之前完成连接。
+   *
+   * @throws std::runtime_error 如果端口不存在或无法连接。
+   */
+  void ConnectPort();
+
+  /**
+   * @brief 将执行器配置中所有任务的节点、前置节点与强制初始化节点的名称解析为节点ID，由`CreateTask`首先调用。
+   *
+   * @throws std::runtime_error 如果配置中的节点不存在。
+   */
+  void ResolveNodeId();
+
+  /**
+   * @brief 为每一对（当前任务组，目标任务组）预计算切换计划，由`CreateTask`在创建任务之后调用。
+   */
+  void BuildTransitionPlan();
+
+  /**
+   * @brief 预热线程主循环，依次构造预热队列中的节点。
+   */
+  void PrewarmLoop();
+
+  /**
+   * @brief 停止预热线程，丢弃尚未构造的节点并等待正在构造的节点完成。
+   */
+  void StopPrewarm();
+
   // 原子指针用于在多线程环境中安全管理期望和当前的任务组
 
   /**
@@ -122,11 +199,64 @@ class Executer : public TaskBase {
   std::unordered_map<std::string, SystemSetting> system_setting_map_;
 
   /**
-   * @brief 排他性任务组的集合。
+   * @brief 切换时需要启动的单个任务。
+   */
+  struct TransitionTask {
+    std::shared_ptr<Task> task;      /**< 任务 */
+    std::vector<NodeBase*> pre_node; /**< 启动前需处于运行状态的前置节点 */
+    std::vector<size_t> init_node;   /**< 启动时需初始化的节点在任务节点列表中的下标 */
+  };
+
+  /**
+   * @brief 从一个任务组切换到另一个任务组的预计算计划。
    *
-   * 包含排他性任务组的名称，这意味着一次只能有一个任务组处于活动状态。
+   * 切换时只需按计划执行，不再查找配置或计算集合，切换耗时与配置规模无关。
+   * 默认先停止当前任务组的所有任务再启动目标任务；启用`overlap_transition_enable`后先接后断：
+   * 两个任务组共用的任务保持运行，只有与待启动任务共用节点的当前任务在启动之前停止，其余当前任务在目标任务启动之后停止。
    */
-  std::set<std::string> exclusive_group_set_;
+  struct TransitionPlan {
+    std::vector<std::shared_ptr<Task>> stop_task;    /**< 启动目标任务之前需要停止的当前任务 */
+    std::vector<TransitionTask> start_task;          /**< 需要启动的目标任务 */
+    std::vector<TransitionTask> keep_task;           /**< 重叠切换时两个任务组共用、保持运行的任务 */
+    std::vector<std::shared_ptr<Task>> release_task; /**< 重叠切换时与目标任务不冲突、在目标任务启动之后停止的当前任务 */
+    std::vector<NodeBase*> exit_node;                /**< 随`stop_task`退出的节点 */
+    std::vector<NodeBase*> release_exit_node;        /**< 随`release_task`退出的节点 */
+    std::vector<NodeBase*> enter_node;               /**< 进入的节点 */
+    std::string exit_node_log;                       /**< 退出节点名称列表，用于日志 */
+    std::string enter_node_log;                      /**< 进入节点名称列表，用于日志 */
+    std::string init_node_log;                       /**< 初始化节点名称列表，用于日志 */
+    std::string running_node_log;                    /**< 运行节点名称列表，用于日志 */
+    uint32_t trace_name;                             /**< 切换的跟踪事件名称序号 */
+  };
+
+  /**
+   * @brief 排他性任务组的名称，按名称排序，下标即任务组下标。
+   *
+   * 最后一个下标表示启动时的空任务组`empty_init`，只作为切换的起点。
+   */
+  std::vector<std::string> group_name_;
+
+  std::unordered_map<std::string, size_t> group_index_; /**< 排他性任务组名称到下标的映射 */
+
+  /**
+   * @brief 切换计划，下标为`当前任务组下标 * 排他性任务组数量 + 目标任务组下标`。
+   */
+  std::vector<TransitionPlan> transition_plan_;
+
+  std::vector<std::vector<NodeBase*>> group_node_; /**< 每个排他性任务组包含的节点 */
+
+  size_t current_group_index_;             /**< 当前任务组下标 */
+  size_t target_group_index_;              /**< 目标任务组下标 */
+  size_t desired_group_index_;             /**< 期望任务组下标，由期望组话题的发布更新 */
+  const TransitionPlan* transition_;       /**< 正在执行的切换计划 */
+  uint64_t transition_trace_start_;        /**< 切换开始的跟踪时间戳计数，未在记录时为0 */
+  std::atomic_bool transition_plan_ready_; /**< 切换计划是否已建立，建立之前执行器不处理期望组 */
+
+  std::thread prewarm_thread_;             /**< 预热线程，首次预热时创建 */
+  std::mutex prewarm_mutex_;               /**< 保护预热队列与预热线程状态的互斥锁 */
+  std::condition_variable prewarm_cv_;     /**< 通知预热线程有新的节点或需要停止 */
+  std::deque<NodeBase*> prewarm_queue_;    /**< 等待预热的节点 */
+  bool prewarm_stop_;                      /**< 预热线程是否已停止 */
 
   /**
    * @brief 用于检索节点指针的 NodeMap 的共享指针。
@@ -142,18 +272,6 @@ class Executer : public TaskBase {
    */
   ExecuterConfig executer_config_;
 
-  /**
-   * @brief 用于管理任务和节点切换的集合。
-   *
-   * 这些集合在切换期间跟踪目标和当前的任务及节点。
-   */
-  std::set<std::shared_ptr<Task>> target_task_set_;
-  std::set<std::shared_ptr<Task>> current_task_set_;
-  std::set<std::string> target_node_set_;
-  std::set<std::string> current_node_set_;
-  std::set<std::string> enter_node_set_;
-  std::set<std::string> exit_node_set_;
-
   /**
    * @brief 用于跟踪节点检查和任务切换状态的标志。
    *
@@ -164,6 +282,7 @@ class Executer : public TaskBase {
   bool task_stop_flag_;
   bool task_start_flag_;
   bool all_current_task_stop_;
+  bool all_release_task_stop_;
 
   /**
    * @brief 用于跟踪目标和期望任务组的字符串。
@@ -189,6 +308,20 @@ class Executer : public TaskBase {
    * @brief 期望任务组主题的名称。
    */
   std::string desired_group_topic_name_;
+
+  /**
+   * @brief 自动分配相位的时间，以毫秒为单位，小于0表示无需分配。
+   *
+   * 任务组启动后先运行一段时间积累运行耗时样本，再按实测运行耗时分配相位。
+   */
+  std::atomic<double> phase_assign_time_;
+
+  /**
+   * @brief 用于读取当前时间的计时器。
+   */
+  TimerOnce phase_assign_timer_;
+
+  static constexpr double kPhaseAssignDelayMs = 1000.0; /**< 任务组启动后等待多久再分配相位，以毫秒为单位 */
 };
 
 }  // namespace ocm
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "common/histogram.hpp"
+#include "common/node_profile.hpp"
+#include "ocm/shard_memory_data.hpp"
+
+namespace ocm {
+
+constexpr uint32_t kMonitorMagic = 0x4f434d4d;     /**< 监控共享内存段魔数 "OCMM" */
+constexpr size_t kMonitorNameSize = 48;            /**< 任务/话题名称的最大长度（含'\0'） */
+constexpr size_t kMonitorTaskSlotNum = 256;        /**< 监控的最大任务数量 */
+constexpr size_t kMonitorTopicSlotNum = 512;       /**< 监控的最大话题数量 */
+constexpr size_t kMonitorNodeSlotNum = 256;        /**< 监控耗时的最大节点数量 */
+constexpr size_t kMonitorLatencySampleNum = 64;    /**< 每个话题保留的最近延迟样本数量 */
+constexpr const char* kMonitorShmName = "monitor"; /**< 监控共享内存段名称 */
+
+/**
+ * @brief 监控槽位的占用状态。
+ */
+enum class MonitorSlotState : uint32_t {
+  FREE = 0, /**< 空闲 */
+  READY     /**< 已占用且名称有效 */
+};
+
+/**
+ * @brief 任务监控数据的快照。
+ */
+struct MonitorTaskSnapshot {
+  std::string name;           /**< 任务名称 */
+  int32_t pid;                /**< 所属进程ID */
+  int32_t tid;                /**< 任务线程ID */
+  uint8_t state;              /**< 任务状态，对应`TaskState` */
+  double period_ms;           /**< 任务周期（毫秒） */
+  double loop_duration_ms;    /**< 上次循环持续时间（毫秒） */
+  double run_duration_ms;     /**< 上次运行持续时间（毫秒） */
+  double max_run_duration_ms; /**< 最大运行持续时间（毫秒） */
+  uint64_t loop_count;        /**< 已运行的循环次数 */
+  uint64_t miss_count;        /**< 错过截止时间的次数 */
+  int64_t last_run_ns;        /**< 上次运行的单调时钟时间（纳秒） */
+};
+
+/**
+ * @brief 单个任务的监控槽位。
+ *
+ * 由任务线程以无锁方式写入，读者通过序列锁获取一致的快照，因此读取不会阻塞实时任务。
+ */
+struct MonitorTaskSlot {
+  std::atomic<MonitorSlotState> slot_state; /**< 槽位占用状态 */
+  std::atomic<uint32_t> seq;                /**< 序列锁，奇数表示正在写入 */
+  std::atomic<int32_t> pid;                 /**< 所属进程ID */
+  std::atomic<int32_t> tid;                 /**< 任务线程ID */
+  char name[kMonitorNameSize];              /**< 任务名称 */
+  std::atomic<uint8_t> state;               /**< 任务状态 */
+  std::atomic<double> period_ms;            /**< 任务周期（毫秒） */
+  std::atomic<double> loop_duration_ms;     /**< 上次循环持续时间（毫秒） */
+  std::atomic<double> run_duration_ms;      /**< 上次运行持续时间（毫秒） */
+  std::atomic<double> max_run_duration_ms;  /**< 最大运行持续时间（毫秒） */
+  std::atomic<uint64_t> loop_count;         /**< 已运行的循环次数 */
+  std::atomic<uint64_t> miss_count;         /**< 错过截止时间的次数 */
+  std::atomic<int64_t> last_run_ns;         /**< 上次运行的单调时钟时间（纳秒） */
+  LatencyHistogram wake_latency;            /**< 唤醒延迟直方图，由任务线程直接写入 */
+  LatencyHistogram run_time;                /**< 运行耗时直方图，由任务线程直接写入 */
+
+  /**
+   * @brief 记录一次循环的计时结果。
+   *
+   * @param state 任务当前状态。
+   * @param loop_duration_ms 循环持续时间（毫秒）。
+   * @param run_duration_ms 运行持续时间（毫秒）。
+   * @param miss_count 错过截止时间的累计次数。
+   * @param now_ns 当前单调时钟时间（纳秒）。
+   */
+  void Update(uint8_t state, double loop_duration_ms, double run_duration_ms, uint64_t miss_count, int64_t now_ns);
+
+  /**
+   * @brief 读取一致的快照。
+   *
+   * @return 任务监控数据的快照。
+   */
+  MonitorTaskSnapshot Read() const;
+};
+
+/**
+ * @brief 话题监控数据的快照。
+ */
+struct MonitorTopicSnapshot {
+  std::string name;                /**< 话题名称（共享内存段名称） */
+  uint32_t size;                   /**< 最近一次发布的消息字节数 */
+  uint64_t publish_count;          /**< 发布次数 */
+  uint64_t receive_count;          /**< 订阅者接收次数 */
+  int64_t last_publish_ns;         /**< 上次发布的单调时钟时间（纳秒） */
+  std::vector<int64_t> latency_ns; /**< 最近的发布到接收延迟样本（纳秒） */
+};
+
+/**
+ * @brief 单个话题的监控槽位。
+ *
+ * 话题按共享内存段名称登记，可被多个进程中的发布者与订阅者同时更新。
+ */
+struct MonitorTopicSlot {
+  std::atomic<MonitorSlotState> slot_state;                  /**< 槽位占用状态 */
+  char name[kMonitorNameSize];                               /**< 话题名称 */
+  std::atomic<uint32_t> size;                                /**< 最近一次发布的消息字节数 */
+  std::atomic<uint64_t> publish_count;                       /**< 发布次数 */
+  std::atomic<uint64_t> receive_count;                       /**< 订阅者接收次数 */
+  std::atomic<int64_t> last_publish_ns;                      /**< 上次发布的单调时钟时间（纳秒） */
+  std::atomic<uint32_t> latency_index;                       /**< 延迟样本环形缓冲区的写入位置 */
+  std::atomic<int64_t> latency_ns[kMonitorLatencySampleNum]; /**< 发布到接收延迟样本环形缓冲区（纳秒） */
+
+  /**
+   * @brief 记录一次发布。
+   *
+   * @param size 消息字节数。
+   */
+  void OnPublish(uint32_t size);
+
+  /**
+   * @brief 记录一次接收，并以最近一次发布时间计算延迟样本。
+   */
+  void OnReceive();
+
+  /**
+   * @brief 读取快照。
+   *
+   * @return 话题监控数据的快照。
+   */
+  MonitorTopicSnapshot Read() const;
+};
+
+/**
+ * @brief 单个节点的耗时监控槽位。
+ *
+ * 节点耗时统计直接写入槽位中的`profile`，同一时刻只有运行该节点的线程写入。
+ */
+struct MonitorNodeSlot {
+  std::atomic<MonitorSlotState> slot_state; /**< 槽位占用状态 */
+  std::atomic<int32_t> pid;                 /**< 所属进程ID */
+  char name[kMonitorNameSize];              /**< 节点名称 */
+  char task_name[kMonitorNameSize];         /**< 所属任务名称 */
+  NodeProfile profile;                      /**< 节点各阶段的耗时统计 */
+};
+
+/**
+ * @brief 监控共享内存段的布局。
+ */
+struct MonitorSegment {
+  std::atomic<uint32_t> magic;                       /**< 魔数，用于校验布局 */
+  MonitorTaskSlot task_slot[kMonitorTaskSlotNum];    /**< 任务槽位 */
+  MonitorTopicSlot topic_slot[kMonitorTopicSlotNum]; /**< 话题槽位 */
+  MonitorNodeSlot node_slot[kMonitorNodeSlotNum];    /**< 节点耗时槽位 */
+};
+
+/**
+ * @class Monitor
+ * @brief 将任务与话题的运行状态导出到共享内存的单例类。
+ *
+ * 所有进程映射同一个共享内存段，各自登记任务与话题槽位并以无锁方式更新，
+ * `ocm-top`等工具只需映射该段即可读取，无需与被监控进程进行任何IPC交互。
+ * 槽位登记时使用共享内存段自带的锁，热路径上的更新不加锁。
+ */
+class Monitor {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  Monitor(const Monitor&) = delete;
+  Monitor& operator=(const Monitor&) = delete;
+
+  /**
+   * @brief 获取Monitor的单例实例。
+   * @return 单例实例的引用。
+   */
+  static Monitor& getInstance();
+
+  /**
+   * @brief 为当前进程中的任务登记槽位。
+   *
+   * 优先复用所属进程已退出的槽位。
+   *
+   * @param name 任务名称。
+   * @return 任务槽位指针，监控不可用或槽位已满时返回`nullptr`。
+   */
+  MonitorTaskSlot* RegisterTask(const std::string& name);
+
+  /**
+   * @brief 释放任务槽位。
+   *
+   * @param slot 由`RegisterTask`返回的槽位指针。
+   */
+  void UnregisterTask(MonitorTaskSlot* slot);
+
+  /**
+   * @brief 为当前进程中的节点登记耗时监控槽位。
+   *
+   * 优先复用所属进程已退出的槽位。
+   *
+   * @param name 节点名称。
+   * @param task_name 节点所属任务名称。
+   * @return 节点槽位指针，监控不可用或槽位已满时返回`nullptr`。
+   */
+  MonitorNodeSlot* RegisterNode(const std::string& name, const std::string& task_name);
+
+  /**
+   * @brief 释放节点槽位。
+   *
+   * @param slot 由`RegisterNode`返回的槽位指针。
+   */
+  void UnregisterNode(MonitorNodeSlot* slot);
+
+  /**
+   * @brief 获取话题槽位，不存在时登记一个新的槽位。
+   *
+   * @param name 话题名称（共享内存段名称）。
+   * @return 话题槽位指针，监控不可用或槽位已满时返回`nullptr`。
+   */
+  MonitorTopicSlot* GetTopic(const std::string& name);
+
+  /**
+   * @brief 获取监控共享内存段。
+   *
+   * @return 监控共享内存段指针，监控不可用时返回`nullptr`。
+   */
+  const MonitorSegment* GetSegment() const;
+
+  /**
+   * @brief 获取当前单调时钟时间。
+   *
+   * @return 单调时钟时间（纳秒）。
+   */
+  static int64_t NowNs();
+
+ private:
+  /**
+   * @brief 私有构造函数，映射监控共享内存段。
+   */
+  Monitor();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~Monitor();
+
+  std::unique_ptr<SharedMemoryData<MonitorSegment>> shm_; /**< 监控共享内存段 */
+  MonitorSegment* segment_;                               /**< 监控共享内存段指针 */
+  std::mutex mutex_;                                      /**< 进程内登记槽位的互斥锁 */
+};
+
+}  // namespace ocm
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <time.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "common/enum.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace ocm {
+
+constexpr size_t kTraceBufferSize = 8192; /**< 每个线程环形缓冲区的事件数量，必须为2的幂 */
+
+/**
+ * @brief 一条跟踪事件，开始与结束时刻相同的事件导出为瞬时事件。
+ */
+struct TraceEvent {
+  uint64_t start;         /**< 开始时刻，`Trace::Now`的时间戳计数 */
+  uint64_t end;           /**< 结束时刻，`Trace::Now`的时间戳计数 */
+  uint32_t name;          /**< 事件名称的登记序号 */
+  TraceCategory category; /**< 事件类别 */
+};
+
+/**
+ * @brief 单个线程的跟踪事件环形缓冲区。
+ *
+ * 只有所属线程写入，只有刷新线程读取，因此无需加锁；缓冲区已满时丢弃新事件并计数。
+ */
+struct TraceBuffer {
+  TraceEvent event[kTraceBufferSize]; /**< 事件环形缓冲区 */
+  std::atomic<uint64_t> head;         /**< 已写入的事件数量，由所属线程更新 */
+  std::atomic<uint64_t> tail;         /**< 已读取的事件数量，由刷新线程更新 */
+  std::atomic<uint64_t> drop;         /**< 缓冲区已满时丢弃的事件数量 */
+  int tid;                            /**< 所属线程ID */
+  std::string thread_name;            /**< 所属线程名称 */
+  bool thread_named;                  /**< 是否已向当前文件写出线程名称，仅由刷新线程访问 */
+};
+
+/**
+ * @class Trace
+ * @brief 记录框架内调度事件并导出为Chrome跟踪JSON的单例类。
+ *
+ * 框架自动记录任务唤醒后的运行、节点的执行与输出、执行器的任务组切换、共享内存话题的发布与订阅以及信号量等待。
+ * 事件以时间戳计数（x86上为TSC）写入各线程的无锁环形缓冲区，由普通调度的后台线程周期性换算为纳秒并写入文件，
+ * 生成的文件可直接在`chrome://tracing`或Perfetto UI中按时间轴查看。未启动时每个记录点只多一次原子读取。
+ */
+class Trace {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  Trace(const Trace&) = delete;
+  Trace& operator=(const Trace&) = delete;
+
+  /**
+   * @brief 获取Trace的单例实例。
+   * @return 单例实例的引用。
+   */
+  static Trace& getInstance();
+
+  /**
+   * @brief 开始记录跟踪事件。
+   *
+   * @param file_path 输出的Chrome跟踪JSON文件路径。
+   * @param flush_period 刷新线程写出缓冲区的周期，以秒为单位。
+   * @return 成功开始返回`true`，已在记录或文件无法打开时返回`false`。
+   */
+  bool Start(const std::string& file_path, double flush_period = 0.1);
+
+  /**
+   * @brief 停止记录，写出剩余事件并关闭文件。
+   */
+  void Stop();
+
+  /**
+   * @brief 登记事件名称，相同名称返回相同序号。
+   *
+   * 需加锁，应在初始化时调用并保存返回的序号，记录事件时只使用序号。
+   *
+   * @param name 事件名称。
+   * @return 事件名称的登记序号。
+   */
+  uint32_t Intern(const std::string& name);
+
+  /**
+   * @brief 是否正在记录跟踪事件。
+   *
+   * @return 正在记录返回`true`。
+   */
+  static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief 读取当前的时间戳计数。
+   *
+   * @return x86上为TSC计数，其它平台为`CLOCK_MONOTONIC`纳秒。
+   */
+  static uint64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + now.tv_nsec;
+#endif
+  }
+
+  /**
+   * @brief 记录一条事件，未在记录时直接返回。
+   *
+   * @param category 事件类别。
+   * @param name 事件名称的登记序号。
+   * @param start 开始时刻，`Now`的返回值。
+   * @param end 结束时刻，`Now`的返回值，与开始时刻相同时为瞬时事件。
+   */
+  static void Record(TraceCategory category, uint32_t name, uint64_t start, uint64_t end) {
+    if (!IsEnabled()) {
+      return;
+    }
+    TraceBuffer* buffer = local_buffer_;
+    if (!buffer) {
+      buffer = local_buffer_ = getInstance().RegisterThread();  // 线程首次记录时登记缓冲区
+    }
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire) >= kTraceBufferSize) {
+      buffer->drop.fetch_add(1, std::memory_order_relaxed);  // 刷新线程来不及写出，丢弃新事件
+      return;
+    }
+    buffer->event[head & (kTraceBufferSize - 1)] = TraceEvent{start, end, name, category};
+    buffer->head.store(head + 1, std::memory_order_release);
+  }
+
+ private:
+  /**
+   * @brief 私有构造函数。
+   */
+  Trace() = default;
+
+  /**
+   * @brief 析构函数，停止记录。
+   */
+  ~Trace();
+
+  /**
+   * @brief 为调用线程创建并登记环形缓冲区，缓冲区在进程退出前不会释放。
+   *
+   * @return 调用线程的环形缓冲区。
+   */
+  TraceBuffer* RegisterThread();
+
+  /**
+   * @brief 刷新线程主循环。
+   *
+   * @param flush_period 刷新周期，以秒为单位。
+   */
+  void FlushLoop(double flush_period);
+
+  /**
+   * @brief 将所有缓冲区中的事件写入文件，调用者需持有`mutex_`。
+   */
+  void Flush();
+
+  static inline std::atomic_bool enabled_{false};                  /**< 是否正在记录 */
+  static inline thread_local TraceBuffer* local_buffer_ = nullptr; /**< 调用线程的环形缓冲区 */
+
+  std::mutex registry_mutex_;                            /**< 保护名称与缓冲区列表的互斥锁，登记时不会等待文件写入 */
+  std::vector<std::string> name_;                        /**< 按登记序号排列的事件名称，已转义为JSON字符串 */
+  std::unordered_map<std::string, uint32_t> name_index_; /**< 事件名称到登记序号的映射 */
+  std::vector<std::unique_ptr<TraceBuffer>> buffer_;     /**< 所有线程的环形缓冲区 */
+  std::mutex mutex_;                                     /**< 保护文件与刷新状态的互斥锁 */
+  std::condition_variable stop_cv_;                      /**< 通知刷新线程停止 */
+  bool stop_ = false;                                    /**< 刷新线程是否需要停止 */
+  std::thread flush_thread_;                             /**< 刷新线程 */
+  FILE* file_ = nullptr;                                 /**< 输出文件 */
+  bool first_event_ = true;                              /**< 是否尚未写出任何事件，用于JSON分隔符 */
+  uint64_t start_tick_ = 0;                              /**< 开始记录时的时间戳计数 */
+  int64_t start_ns_ = 0;                                 /**< 开始记录时的`CLOCK_MONOTONIC`纳秒 */
+  double ns_per_tick_ = 1.0;                             /**< 每个时间戳计数对应的纳秒数 */
+};
+
+/**
+ * @brief 在作用域内记录一条持续事件。
+ *
+ * 构造时未在记录的作用域不记录，作用域内开始记录不影响正确性。
+ */
+class TraceScope {
+ public:
+  /**
+   * @brief 构造时记录开始时刻。
+   *
+   * @param category 事件类别。
+   * @param name 事件名称的登记序号。
+   */
+  TraceScope(TraceCategory category, uint32_t name) : category_(category), name_(name), start_(Trace::IsEnabled() ? Trace::Now() : 0) {}
+
+  /**
+   * @brief 析构时记录结束时刻并写入事件。
+   */
+  ~TraceScope() {
+    if (start_ != 0) {
+      Trace::Record(category_, name_, start_, Trace::Now());
+    }
+  }
+
+  // 删除拷贝构造函数和赋值运算符
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  TraceCategory category_; /**< 事件类别 */
+  uint32_t name_;          /**< 事件名称的登记序号 */
+  uint64_t start_;         /**< 开始时刻，未在记录时为0 */
+};
+
+}  // namespace ocm
@@ -2,8 +2,15 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 #include "common/enum.hpp"
+#include "common/node_profile.hpp"
+#include "monitor/monitor.hpp"
+#include "node/port.hpp"
 #include "debug_anywhere/debug_anywhere.hpp"
 #include "log_anywhere/log_anywhere.hpp"
 
@@ -46,9 +53,9 @@ class NodeBase {
   /**
    * @brief 虚析构函数。
    *
-   * 确保通过基类指针删除实例时，派生类的析构函数被正确调用。
+   * 确保通过基类指针删除实例时，派生类的析构函数被正确调用，并释放节点耗时监控槽位。
    */
-  virtual ~NodeBase() = default;
+  virtual ~NodeBase();
 
   /**
    * @brief 构造节点。
@@ -108,7 +115,50 @@ class NodeBase {
   virtual void AfterExit() = 0;
 
   /**
-   * @brief 设置节点的状态。
+   * @brief 异步检查节点能否进入活动状态。
+   *
+   * 默认同步调用`TryEnter`并立即完成。检查耗时或依赖其它线程的节点可重写此方法：立即返回，检查完成后在任意线程调用`done`，
+   * 检查通过时执行器被立即唤醒并继续切换，而不必等到下一个执行器周期。
+   *
+   * @param done 检查完成回调，参数为能否进入。
+   */
+  virtual void TryEnterAsync(std::function<void(bool)> done);
+
+  /**
+   * @brief 异步检查节点能否退出活动状态。
+   *
+   * 默认同步调用`TryExit`并立即完成，重写方式与`TryEnterAsync`相同。
+   *
+   * @param done 检查完成回调，参数为能否退出。
+   */
+  virtual void TryExitAsync(std::function<void(bool)> done);
+
+  /**
+   * @brief 切换期间检查节点能否进入，由执行器调用。
+   *
+   * 没有进行中的检查时发起一次`TryEnterAsync`；检查通过后保持通过，直到`ResetTransitionCheck`。
+   * 检查通过时通过`StateNotifier`唤醒等待者，未通过时由执行器稍后重新发起。
+   *
+   * @return 检查已通过返回`true`。
+   */
+  bool CheckEnter();
+
+  /**
+   * @brief 切换期间检查节点能否退出，由执行器调用，行为与`CheckEnter`相同。
+   *
+   * @return 检查已通过返回`true`。
+   */
+  bool CheckExit();
+
+  /**
+   * @brief 清除已通过的进入与退出检查结果，由执行器在切换开始时调用。
+   *
+   * 进行中的异步检查保留，其结果用于本次切换。
+   */
+  void ResetTransitionCheck();
+
+  /**
+   * @brief 设置节点的状态，状态变化时通过`StateNotifier`通知等待者。
    *
    * @param state 要为节点设置的新状态。
    */
@@ -142,13 +192,103 @@ class NodeBase {
    */
   void SetIsConstruct(bool is_construct);
 
+  /**
+   * @brief 构造尚未构造的节点。
+   *
+   * 可由预热线程在节点运行之前调用，也由任务在首次运行节点时调用；多个线程同时调用时只有一个线程执行`Construct`，
+   * 其余线程等待构造完成。
+   *
+   * @return 本次调用执行了构造时返回`true`，节点已构造时返回`false`。
+   */
+  bool ConstructOnce();
+
+  /**
+   * @brief 启用节点耗时统计。
+   *
+   * 首次调用时在共享内存监控段中登记节点槽位，监控不可用时改用本地统计，重复调用直接返回已有的统计。
+   *
+   * @param task_name 节点所属任务名称。
+   * @return 节点耗时统计指针。
+   */
+  NodeProfile* EnableProfile(const std::string& task_name);
+
+  /**
+   * @brief 获取节点耗时统计。
+   *
+   * @return 节点耗时统计指针，未启用时返回`nullptr`。
+   */
+  NodeProfile* GetProfile() const;
+
+  /**
+   * @brief 获取节点某一阶段耗时的统计摘要。
+   *
+   * @param phase 节点阶段。
+   * @return 耗时的统计摘要，以纳秒为单位，未启用时返回空摘要。
+   */
+  HistogramSummary GetProfileSummary(NodePhase phase) const;
+
+  /**
+   * @brief 获取节点某一阶段的最长耗时记录。
+   *
+   * @param phase 节点阶段。
+   * @return 最长耗时记录，未启用时返回空记录。
+   */
+  NodeWorstCase GetWorstCase(NodePhase phase) const;
+
+  /**
+   * @brief 按名称与方向获取节点的数据端口。
+   *
+   * @param port_name 端口名称。
+   * @param direction 端口方向。
+   * @return 端口指针，不存在时返回`nullptr`。
+   */
+  PortBase* GetPort(const std::string& port_name, PortDirection direction) const;
+
+  /**
+   * @brief 锁存所有输入端口最新发布的数据，由任务在每次运行节点之前调用。
+   */
+  void LatchInputs();
+
+  /**
+   * @brief 发布所有输出端口本周期写入的数据，由任务在每次运行节点之后调用。
+   */
+  void PublishOutputs();
+
   std::shared_ptr<spdlog::logger> log_anywhere_ = GetLogger();  // 获取日志实例
   DebugAnywhere& debug_anywhere_ = DebugAnywhere::getInstance();
 
  private:
-  bool is_construct_ = false;
-  std::string node_name_;        /**< 节点的唯一名称标识符 */
-  std::atomic<NodeState> state_; /**< 节点的当前状态，通过原子操作管理以确保线程安全 */
+  friend class PortBase;
+
+  /**
+   * @brief 登记节点的数据端口，由端口构造时调用。
+   *
+   * @param port 端口指针。
+   *
+   * @throws std::runtime_error 如果已存在同名同方向的端口。
+   */
+  void RegisterPort(PortBase* port);
+
+  /**
+   * @brief 按检查状态发起或读取一次进入或退出检查。
+   *
+   * @param check 进入或退出检查的状态。
+   * @param enter 是否为进入检查。
+   * @return 检查已通过返回`true`。
+   */
+  bool RunTransitionCheck(std::atomic<NodeCheckState>& check, bool enter);
+
+  std::atomic_bool is_construct_{false};       /**< 节点是否已构造 */
+  std::mutex construct_mutex_;                 /**< 保证节点只构造一次的互斥锁 */
+  std::string node_name_;                      /**< 节点的唯一名称标识符 */
+  std::atomic<NodeState> state_;               /**< 节点的当前状态，通过原子操作管理以确保线程安全 */
+  std::atomic<NodeCheckState> enter_check_;    /**< 切换期间进入检查的状态 */
+  std::atomic<NodeCheckState> exit_check_;     /**< 切换期间退出检查的状态 */
+  MonitorNodeSlot* monitor_slot_ = nullptr;    /**< 导出到共享内存的节点耗时槽位，监控不可用时为`nullptr` */
+  std::unique_ptr<NodeProfile> local_profile_; /**< 监控不可用时使用的本地耗时统计 */
+  std::atomic<NodeProfile*> profile_{nullptr}; /**< 节点耗时统计，未启用时为`nullptr` */
+  std::vector<PortBase*> input_port_;          /**< 输入端口，由派生类的端口成员持有 */
+  std::vector<PortBase*> output_port_;         /**< 输出端口，由派生类的端口成员持有 */
 };
 
 }  // namespace ocm
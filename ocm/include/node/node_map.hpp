@@ -4,6 +4,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include "common/struct_type.hpp"
 #include "log_anywhere/log_anywhere.hpp"
 #include "node/node.hpp"
 
@@ -11,11 +13,14 @@ namespace ocm {
 
 /**
  * @class NodeMap
- * @brief 管理一组节点，允许通过名称添加和检索节点。
+ * @brief 管理一组节点，允许通过名称或整数ID添加和检索节点。
  *
  * NodeMap类提供了存储和管理通过唯一字符串标识的节点的功能。
  * 它确保每个节点名称在映射中是唯一的，并提供添加新节点和检索现有节点的方法。
- * 尝试添加具有重复名称的节点或检索不存在的节点将导致异常。
+ * 检索不存在的节点将导致异常。
+ *
+ * 节点在添加时按顺序分配稠密的整数ID，按ID检索只是一次数组访问，供执行器在运行期使用；
+ * 按名称检索需要一次哈希查找，只应在初始化时使用，执行器在创建任务时将配置中的节点名称解析为ID。
  *
  * @note 此类被标记为 `final` 以防止继承。
  */
@@ -39,18 +44,54 @@ class NodeMap final {
   /**
    * @brief 向映射中添加一个新节点。
    *
-   * 此方法将一个具有指定名称和指针的新节点插入到 `NodeMap` 中。
+   * 此方法将一个具有指定名称和指针的新节点插入到 `NodeMap` 中，并为其分配ID；名称已存在时不做修改。
    *
    * @param node_name 节点的唯一名称标识。
    * @param node_ptr 一个指向要添加的节点的 `std::shared_ptr`。
+   * @return 节点的ID。
+   */
+  NodeId AddNode(const std::string& node_name, std::shared_ptr<NodeBase> node_ptr);
+
+  /**
+   * @brief 通过名称获取节点ID。
+   *
+   * @param node_name 节点的名称标识。
+   * @return 节点的ID。
+   *
+   * @throws std::runtime_error 如果在映射中未找到具有指定名称的节点。
+   */
+  NodeId GetNodeId(const std::string& node_name) const;
+
+  /**
+   * @brief 通过ID检索节点指针。
+   *
+   * 不检查ID是否有效，ID必须由`AddNode`或`GetNodeId`返回。
+   *
+   * @param id 节点的ID。
+   * @return 节点对应的 `std::shared_ptr<NodeBase>` 的常量引用。
+   */
+  const std::shared_ptr<NodeBase>& GetNodePtr(NodeId id) const { return node_list_[id]; }
+
+  /**
+   * @brief 通过ID获取节点名称。
+   *
+   * @param id 节点的ID。
+   * @return 节点的名称标识。
+   */
+  const std::string& GetNodeName(NodeId id) const { return node_name_[id]; }
+
+  /**
+   * @brief 获取已添加的节点数量，即ID的上界。
+   *
+   * @return 节点数量。
    */
-  void AddNode(const std::string& node_name, std::shared_ptr<NodeBase> node_ptr);
+  size_t GetNodeNum() const { return node_list_.size(); }
 
   /**
    * @brief 通过名称检索节点指针。
    *
    * 此方法搜索具有指定名称的节点，并返回其 `std::shared_ptr<NodeBase>` 的引用。
-   * 如果节点不存在，方法将抛出 `std::runtime_error`。
+   * 如果节点不存在，方法将抛出 `std::runtime_error`。运行期应改用按ID检索的重载。
    *
    * @param key 要检索的节点的名称标识。
    * @return 节点对应的 `std::shared_ptr<NodeBase>` 的常量引用。
@@ -61,12 +102,13 @@ class NodeMap final {
 
  private:
   /**
-   * @brief 存储节点名称及其对应指针的内部映射。
+   * @brief 节点名称到节点ID的映射。
    *
-   * 键是表示节点名称的唯一字符串，值是指向 `NodeBase` 实例的 `std::shared_ptr`。
-   * 这个映射确保了节点的高效检索和管理。
+   * 键是表示节点名称的唯一字符串，值是节点在`node_list_`中的下标。
    */
-  std::unordered_map<std::string, std::shared_ptr<NodeBase>> node_map_;
+  std::unordered_map<std::string, NodeId> node_id_;
+  std::vector<std::shared_ptr<NodeBase>> node_list_; /**< 按ID排列的节点指针 */
+  std::vector<std::string> node_name_;               /**< 按ID排列的节点名称 */
   std::shared_ptr<spdlog::logger> logger_ = GetLogger();
 };
 
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <vector>
+#include "common/enum.hpp"
+
+namespace ocm {
+
+class NodeBase;
+
+/**
+ * @class PortChannel
+ * @brief 单写者多读者的无锁多缓冲区，连接一个输出端口与若干输入端口。
+ *
+ * 缓冲区数量为读者数量加2：最新发布的缓冲区、写者正在写入的缓冲区，以及每个读者各自持有的一个缓冲区，
+ * 因此写者发布后总能找到一个无人持有的缓冲区继续写入，不会阻塞。读者持有缓冲区期间通过引用计数防止被写者复用，
+ * 拿到的数据在下一次锁存之前保持不变，且无需拷贝。
+ *
+ * 读者先增加引用计数再确认该缓冲区仍是最新的，写者先发布再检查引用计数，两侧均使用顺序一致的原子操作，
+ * 保证写者不会选中读者正在获取的缓冲区。
+ *
+ * @tparam T 数据类型，需可默认构造。
+ */
+template <typename T>
+class PortChannel {
+ public:
+  /**
+   * @brief 单个缓冲区。
+   */
+  struct Slot {
+    T data;                    /**< 数据 */
+    uint64_t seq = 0;          /**< 发布序号，0表示从未发布 */
+    std::atomic<uint32_t> ref; /**< 持有该缓冲区的读者数量 */
+  };
+
+  /**
+   * @brief 构造一个`PortChannel`实例，所有缓冲区保存默认构造的数据。
+   *
+   * @param reader_num 读者数量。
+   */
+  explicit PortChannel(size_t reader_num) : slot_num_(reader_num + 2), slot_(std::make_unique<Slot[]>(reader_num + 2)), back_(1), seq_(0) {
+    for (size_t i = 0; i < slot_num_; ++i) {
+      slot_[i].ref.store(0);
+    }
+    latest_.store(0);
+  }
+
+  // 删除拷贝构造函数和赋值运算符
+  PortChannel(const PortChannel&) = delete;
+  PortChannel& operator=(const PortChannel&) = delete;
+
+  /**
+   * @brief 获取写者正在写入的缓冲区，仅由写者调用。
+   *
+   * @return 缓冲区中数据的引用，内容为若干次发布之前的数据。
+   */
+  T& Back() { return slot_[back_].data; }
+
+  /**
+   * @brief 发布写者正在写入的缓冲区，并选择下一个无人持有的缓冲区继续写入，仅由写者调用。
+   */
+  void Publish() {
+    slot_[back_].seq = ++seq_;
+    latest_.store(static_cast<uint32_t>(back_));
+    for (size_t i = 1; i < slot_num_; ++i) {
+      size_t index = (back_ + i) % slot_num_;
+      if (slot_[index].ref.load() == 0) {
+        back_ = index;  // 缓冲区数量保证至少有一个无人持有的缓冲区
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief 获取并持有最新发布的缓冲区，由读者调用。
+   *
+   * @return 缓冲区指针，需通过`Release`释放。
+   */
+  Slot* Acquire() {
+    while (true) {
+      uint32_t index = latest_.load();
+      slot_[index].ref.fetch_add(1);
+      if (latest_.load() == index) {
+        return &slot_[index];
+      }
+      slot_[index].ref.fetch_sub(1);  // 获取过程中写者发布了新的数据，重试
+    }
+  }
+
+  /**
+   * @brief 释放读者持有的缓冲区。
+   *
+   * @param slot 由`Acquire`返回的缓冲区指针。
+   */
+  void Release(Slot* slot) { slot->ref.fetch_sub(1, std::memory_order_release); }
+
+  /**
+   * @brief 判断缓冲区是否为最新发布的缓冲区。
+   *
+   * @param slot 缓冲区指针。
+   * @return 是否为最新发布的缓冲区。
+   */
+  bool IsLatest(const Slot* slot) const { return &slot_[latest_.load(std::memory_order_acquire)] == slot; }
+
+ private:
+  size_t slot_num_;              /**< 缓冲区数量 */
+  std::unique_ptr<Slot[]> slot_; /**< 缓冲区 */
+  std::atomic<uint32_t> latest_; /**< 最新发布的缓冲区下标 */
+  size_t back_;                  /**< 写者正在写入的缓冲区下标 */
+  uint64_t seq_;                 /**< 发布次数 */
+};
+
+/**
+ * @class PortBase
+ * @brief 节点数据端口的类型无关基类。
+ *
+ * 端口作为节点的成员声明，构造时登记到所属节点，由执行器按配置中的名称连接。
+ * 任务在每次运行节点之前锁存其所有输入端口，运行之后发布其所有被写入过的输出端口。
+ */
+class PortBase {
+ public:
+  /**
+   * @brief 构造一个端口并登记到所属节点。
+   *
+   * @param node 所属节点。
+   * @param name 端口名称，在同一节点的同方向端口中唯一。
+   * @param direction 端口方向。
+   * @param type 端口数据类型。
+   *
+   * @throws std::runtime_error 如果同一节点中已存在同名同方向的端口。
+   */
+  PortBase(NodeBase* node, const std::string& name, PortDirection direction, std::type_index type);
+
+  /**
+   * @brief 虚析构函数。
+   */
+  virtual ~PortBase() = default;
+
+  // 删除拷贝构造函数和赋值运算符
+  PortBase(const PortBase&) = delete;
+  PortBase& operator=(const PortBase&) = delete;
+
+  /**
+   * @brief 获取端口名称。
+   *
+   * @return 端口名称。
+   */
+  const std::string& GetName() const;
+
+  /**
+   * @brief 获取端口方向。
+   *
+   * @return 端口方向。
+   */
+  PortDirection GetDirection() const;
+
+  /**
+   * @brief 获取端口数据类型。
+   *
+   * @return 端口数据类型。
+   */
+  std::type_index GetType() const;
+
+  /**
+   * @brief 连接输出端口与输入端口。
+   *
+   * 一个输出端口可连接多个输入端口，一个输入端口只能连接一个输出端口。需在任务开始运行之前调用。
+   *
+   * @param output 输出端口。
+   * @param input 输入端口。
+   *
+   * @throws std::runtime_error 如果端口方向或数据类型不匹配，或输入端口已被连接。
+   */
+  static void Connect(PortBase& output, PortBase& input);
+
+  /**
+   * @brief 锁存最新发布的数据，仅对输入端口有效。
+   */
+  virtual void Latch() {}
+
+  /**
+   * @brief 发布本周期写入的数据，仅对输出端口有效。
+   */
+  virtual void Publish() {}
+
+ protected:
+  /**
+   * @brief 将输入端口绑定到本输出端口，由`Connect`在检查通过后调用。
+   *
+   * @param input 输入端口。
+   */
+  virtual void Attach(PortBase& input) { (void)input; }
+
+  bool connected_ = false; /**< 端口是否已连接 */
+
+ private:
+  std::string name_;        /**< 端口名称 */
+  PortDirection direction_; /**< 端口方向 */
+  std::type_index type_;    /**< 端口数据类型 */
+};
+
+template <typename T>
+class OutputPort;
+
+/**
+ * @class InputPort
+ * @brief 节点的类型化输入端口。
+ *
+ * 每个周期节点运行之前锁存连接的输出端口最新发布的数据，本周期内`Get`返回同一份数据的只读引用，无需拷贝。
+ * 未连接时返回默认构造的数据。
+ *
+ * @tparam T 数据类型，需可默认构造。
+ */
+template <typename T>
+class InputPort final : public PortBase {
+ public:
+  /**
+   * @brief 构造一个输入端口并登记到所属节点。
+   *
+   * @param node 所属节点，通常为`this`。
+   * @param name 端口名称。
+   */
+  InputPort(NodeBase* node, const std::string& name) : PortBase(node, name, PortDirection::INPUT, typeid(T)) {
+    Bind(std::make_shared<PortChannel<T>>(0));  // 未连接时使用仅含默认数据的通道
+  }
+
+  /**
+   * @brief 析构函数，释放持有的缓冲区。
+   */
+  ~InputPort() override { channel_->Release(held_); }
+
+  /**
+   * @brief 获取本周期锁存的数据。
+   *
+   * @return 数据的只读引用，在下一次锁存之前保持不变。
+   */
+  const T& Get() const { return held_->data; }
+
+  /**
+   * @brief 获取本周期锁存的数据的发布序号。
+   *
+   * @return 发布序号，0表示输出端口尚未发布过数据，序号未变表示没有新数据。
+   */
+  uint64_t GetSeq() const { return held_->seq; }
+
+  /**
+   * @brief 锁存最新发布的数据。
+   */
+  void Latch() override {
+    if (channel_->IsLatest(held_)) {
+      return;  // 没有新数据
+    }
+    channel_->Release(held_);  // 先释放再获取，保证读者最多持有一个缓冲区
+    held_ = channel_->Acquire();
+  }
+
+ private:
+  friend class OutputPort<T>;
+
+  /**
+   * @brief 绑定到新的通道。
+   *
+   * @param channel 通道。
+   */
+  void Bind(const std::shared_ptr<PortChannel<T>>& channel) {
+    if (channel_) {
+      channel_->Release(held_);
+    }
+    channel_ = channel;
+    held_ = channel_->Acquire();
+  }
+
+  std::shared_ptr<PortChannel<T>> channel_;       /**< 连接的通道 */
+  typename PortChannel<T>::Slot* held_ = nullptr; /**< 本周期持有的缓冲区 */
+};
+
+/**
+ * @class OutputPort
+ * @brief 节点的类型化输出端口。
+ *
+ * 节点通过`Write`直接在缓冲区中写入数据，节点运行结束后由任务统一发布，写入与发布均不会阻塞。
+ * `Write`返回的缓冲区内容为若干次发布之前的数据，节点应完整写入所有字段。
+ *
+ * @tparam T 数据类型，需可默认构造。
+ */
+template <typename T>
+class OutputPort final : public PortBase {
+ public:
+  /**
+   * @brief 构造一个输出端口并登记到所属节点。
+   *
+   * @param node 所属节点，通常为`this`。
+   * @param name 端口名称。
+   */
+  OutputPort(NodeBase* node, const std::string& name)
+      : PortBase(node, name, PortDirection::OUTPUT, typeid(T)), channel_(std::make_shared<PortChannel<T>>(0)), dirty_(false) {}
+
+  /**
+   * @brief 获取可写入的缓冲区，并标记本周期需要发布。
+   *
+   * @return 缓冲区中数据的引用。
+   */
+  T& Write() {
+    dirty_ = true;
+    return channel_->Back();
+  }
+
+  /**
+   * @brief 发布本周期写入的数据，未调用`Write`时不发布。
+   */
+  void Publish() override {
+    if (dirty_) {
+      channel_->Publish();
+      dirty_ = false;
+    }
+  }
+
+ protected:
+  /**
+   * @brief 绑定新的输入端口，按读者数量重建通道并重新绑定所有已连接的输入端口。
+   *
+   * @param input 输入端口。
+   */
+  void Attach(PortBase& input) override {
+    reader_.push_back(static_cast<InputPort<T>*>(&input));
+    channel_ = std::make_shared<PortChannel<T>>(reader_.size());
+    for (auto* reader : reader_) {
+      reader->Bind(channel_);
+    }
+  }
+
+ private:
+  std::shared_ptr<PortChannel<T>> channel_; /**< 通道 */
+  std::vector<InputPort<T>*> reader_;       /**< 已连接的输入端口 */
+  bool dirty_;                              /**< 本周期是否写入过数据 */
+};
+
+}  // namespace ocm
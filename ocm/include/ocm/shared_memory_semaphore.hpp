@@ -131,8 +131,9 @@ class SharedMemorySemaphore {
   void Destroy();
 
  private:
-  sem_t* sem_ = nullptr; /**< 指向 POSIX 信号量的指针。 */
-  std::string name_;     /**< 信号量的名称标识符。 */
+  sem_t* sem_ = nullptr;    /**< 指向 POSIX 信号量的指针。 */
+  std::string name_;        /**< 信号量的名称标识符。 */
+  uint32_t trace_name_ = 0; /**< 等待信号量的跟踪事件名称序号。 */
 };
 
 }  // namespace ocm
@@ -4,8 +4,11 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "monitor/monitor.hpp"
+#include "monitor/trace.hpp"
 #include "ocm/shard_memory_data.hpp"
 #include "ocm/shared_memory_semaphore.hpp"
+#include "ocm/topic_signal.hpp"
 #include "rclcpp/serialization.hpp"
 #include "rclcpp/serialized_message.hpp"
 #include "rcutils/types.h"
@@ -75,6 +78,7 @@ class SharedMemoryTopicRos2 {
    */
   template <class MessageType>
   void Publish(const std::string& topic_name, const std::string& shm_name, const MessageType& msg) {
+    TraceScope trace(TraceCategory::PUBLISH, TraceName(shm_name));
     WriteDataToSHM(shm_name, msg);
     PublishSem(topic_name);
   }
@@ -93,6 +97,7 @@ class SharedMemoryTopicRos2 {
    */
   template <class MessageType>
   void PublishList(const std::vector<std::string>& topic_names, const std::string& shm_name, const std::vector<MessageType>& msgs) {
+    TraceScope trace(TraceCategory::PUBLISH, TraceName(shm_name));
     WriteDataToSHM(shm_name, msgs);
     for (const auto& topic : topic_names) {
       PublishSem(topic);
@@ -117,6 +122,7 @@ class SharedMemoryTopicRos2 {
   void Subscribe(const std::string& topic_name, const std::string& shm_name, Callback callback) {
     CheckSemExist(topic_name);
     sem_map_.at(topic_name)->Decrement();
+    TraceScope trace(TraceCategory::SUBSCRIBE, TraceName(shm_name));  // 只记录被唤醒之后的读取与回调，等待由信号量记录
     CheckSHMExist(shm_name, false);
     MessageType msg;
     rclcpp::Serialization<MessageType> serializer;
@@ -137,6 +143,7 @@ class SharedMemoryTopicRos2 {
     serialized_msg.get_rcl_serialized_message().buffer_capacity = 0;
 
     shm_map_.at(shm_name)->UnLock();
+    MonitorReceive(shm_name);
     callback(msg);
   }
 
@@ -156,6 +163,7 @@ class SharedMemoryTopicRos2 {
   void SubscribeNoWait(const std::string& topic_name, const std::string& shm_name, Callback callback) {
     CheckSemExist(topic_name);
     if (sem_map_.at(topic_name)->TryDecrement()) {
+      TraceScope trace(TraceCategory::SUBSCRIBE, TraceName(shm_name));
       CheckSHMExist(shm_name, false);
       MessageType msg;
       rclcpp::Serialization<MessageType> serializer;
@@ -176,6 +184,7 @@ class SharedMemoryTopicRos2 {
       serialized_msg.get_rcl_serialized_message().buffer_capacity = 0;
 
       shm_map_.at(shm_name)->UnLock();
+      MonitorReceive(shm_name);
       callback(msg);
     }
   }
@@ -197,6 +206,7 @@ class SharedMemoryTopicRos2 {
   void SubscribeTimeout(const std::string& topic_name, const std::string& shm_name, Callback callback, int timeout) {
     CheckSemExist(topic_name);
     if (sem_map_.at(topic_name)->DecrementTimeout(timeout)) {
+      TraceScope trace(TraceCategory::SUBSCRIBE, TraceName(shm_name));
       CheckSHMExist(shm_name, false);
       MessageType msg;
       rclcpp::Serialization<MessageType> serializer;
@@ -217,6 +227,7 @@ class SharedMemoryTopicRos2 {
       serialized_msg.get_rcl_serialized_message().buffer_capacity = 0;
 
       shm_map_.at(shm_name)->UnLock();
+      MonitorReceive(shm_name);
       callback(msg);
     }
   }
@@ -243,12 +254,13 @@ class SharedMemoryTopicRos2 {
     shm_map_.at(shm_name)->Lock();
     std::memcpy(shm_map_.at(shm_name)->Get(), serialized_msg.get_rcl_serialized_message().buffer, datalen);
     shm_map_.at(shm_name)->UnLock();
+    MonitorPublish(shm_name, datalen);
   }
 
   /**
    * @brief 信号量通知主题。
    *
-   * 如果指定的 `topic_name` 当前值为零，则增加其信号量。
+   * 如果指定的 `topic_name` 当前值为零，则增加其信号量，并通知绑定该主题的`TOPIC_TRIGGER`任务。
    *
    * @param topic_name 要通知的主题名。
    *
@@ -257,6 +269,11 @@ class SharedMemoryTopicRos2 {
   void PublishSem(const std::string& topic_name) {
     CheckSemExist(topic_name);
     sem_map_.at(topic_name)->IncrementWhenZero();
+    auto it = signal_map_.find(topic_name);
+    if (it == signal_map_.end()) {
+      it = signal_map_.emplace(topic_name, TopicSignal::getInstance().GetSlot(topic_name)).first;
+    }
+    TopicSignal::getInstance().Notify(it->second);
   }
 
   /**
@@ -292,8 +309,65 @@ class SharedMemoryTopicRos2 {
     }
   }
 
+  /**
+   * @brief 记录一次发布到监控共享内存。
+   *
+   * @param shm_name 共享内存段的名称。
+   * @param size 消息字节数。
+   */
+  void MonitorPublish(const std::string& shm_name, int size) {
+    if (MonitorTopicSlot* slot = GetMonitorTopic(shm_name)) {
+      slot->OnPublish(static_cast<uint32_t>(size));
+    }
+  }
+
+  /**
+   * @brief 记录一次接收到监控共享内存。
+   *
+   * @param shm_name 共享内存段的名称。
+   */
+  void MonitorReceive(const std::string& shm_name) {
+    if (MonitorTopicSlot* slot = GetMonitorTopic(shm_name)) {
+      slot->OnReceive();
+    }
+  }
+
+  /**
+   * @brief 获取并缓存共享内存段对应的话题监控槽位。
+   *
+   * @param shm_name 共享内存段的名称。
+   * @return 话题监控槽位指针，监控不可用时返回`nullptr`。
+   */
+  MonitorTopicSlot* GetMonitorTopic(const std::string& shm_name) {
+    auto it = monitor_map_.find(shm_name);
+    if (it == monitor_map_.end()) {
+      it = monitor_map_.emplace(shm_name, Monitor::getInstance().GetTopic(shm_name)).first;
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief 获取并缓存共享内存段对应的跟踪事件名称序号。
+   *
+   * @param shm_name 共享内存段的名称。
+   * @return 跟踪事件名称序号，未在记录跟踪事件时返回0且不登记。
+   */
+  uint32_t TraceName(const std::string& shm_name) {
+    if (!Trace::IsEnabled()) {
+      return 0;
+    }
+    auto it = trace_map_.find(shm_name);
+    if (it == trace_map_.end()) {
+      it = trace_map_.emplace(shm_name, Trace::getInstance().Intern(shm_name)).first;
+    }
+    return it->second;
+  }
+
   std::unordered_map<std::string, std::shared_ptr<SharedMemoryData<uint8_t>>> shm_map_; /**< 共享内存段的名称键映射。 */
   std::unordered_map<std::string, std::shared_ptr<SharedMemorySemaphore>> sem_map_;     /**< 主题名称键的信号量映射。 */
+  std::unordered_map<std::string, MonitorTopicSlot*> monitor_map_;                      /**< 共享内存段名称键的话题监控槽位映射。 */
+  std::unordered_map<std::string, TopicSignalSlot*> signal_map_;                        /**< 主题名称键的话题通知槽位映射。 */
+  std::unordered_map<std::string, uint32_t> trace_map_;                                 /**< 共享内存段名称键的跟踪事件名称序号映射。 */
 };
 
 }  // namespace ocm
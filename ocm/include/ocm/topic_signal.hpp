@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "ocm/shard_memory_data.hpp"
+
+namespace ocm {
+
+constexpr uint32_t kTopicSignalMagic = 0x4f434d32;          /**< 话题通知共享内存段魔数 "OCM2"，布局改变时随之修改 */
+constexpr size_t kTopicSignalNameSize = 48;                 /**< 话题名称的最大长度（含'\0'） */
+constexpr size_t kTopicSignalSlotNum = 512;                 /**< 最大话题数量 */
+constexpr const char* kTopicSignalShmName = "topic_signal"; /**< 话题通知共享内存段名称 */
+
+/**
+ * @brief 单个话题的发布通知槽位。
+ *
+ * `seq`只在发布时递增，订阅者据此判断是否有新数据；`wake`在发布与订阅者被要求立即唤醒时都会递增，作为futex字使用，
+ * 因此唤醒某个订阅者不会让同一话题的其它订阅者误认为有新数据。
+ */
+struct TopicSignalSlot {
+  std::atomic<uint32_t> ready;         /**< 槽位是否已占用且名称有效 */
+  std::atomic<uint32_t> seq;           /**< 发布序号 */
+  std::atomic<uint32_t> wake;          /**< 唤醒序号，同时作为跨进程futex字 */
+  std::atomic<uint32_t> waiters;       /**< 在`wake`上等待的订阅者数量，为0时发布者跳过唤醒系统调用 */
+  std::atomic<uint32_t> epoch_waiters; /**< 绑定了该话题且在`epoch`上等待的订阅者数量，为0时发布者跳过`epoch`的唤醒 */
+  std::atomic<int64_t> publish_ns;     /**< 最近一次发布的时间，`CLOCK_MONOTONIC`纳秒 */
+  char name[kTopicSignalNameSize];     /**< 话题名称 */
+};
+
+/**
+ * @brief 话题通知共享内存段的布局。
+ *
+ * 等待多个话题中任意一个的订阅者无法同时在多个futex字上等待，改为在全局的`epoch`上等待，被唤醒后重新检查各自的话题。
+ * 每个槽位按下标对应futex位集合中的一位，订阅者只等待所绑定话题的位，发布者只唤醒本话题的位，
+ * 因此一次发布不会唤醒所有等待`epoch`的订阅者。
+ */
+struct TopicSignalSegment {
+  std::atomic<uint32_t> magic;               /**< 魔数，用于校验布局 */
+  std::atomic<uint32_t> epoch;               /**< 任意话题发布时递增，同时作为跨进程futex字 */
+  TopicSignalSlot slot[kTopicSignalSlotNum]; /**< 话题槽位 */
+};
+
+/**
+ * @brief 获取话题槽位在`epoch`上等待与唤醒使用的futex位。
+ *
+ * @param segment 话题通知共享内存段。
+ * @param slot 话题槽位。
+ * @return 只含一位的futex位集合。
+ */
+inline uint32_t TopicSignalBit(const TopicSignalSegment* segment, const TopicSignalSlot* slot) {
+  return 1u << (static_cast<uint32_t>(slot - segment->slot) % 32);
+}
+
+/**
+ * @class TopicSignal
+ * @brief 将共享内存话题的发布事件导出到共享内存的单例类，供`TOPIC_TRIGGER`任务等待。
+ *
+ * 话题发布者在写入数据后调用`Notify`，仅在有订阅者等待时才进入内核。
+ * 该通知独立于话题自身的信号量，不会消耗普通订阅者的信号量计数。
+ */
+class TopicSignal {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  TopicSignal(const TopicSignal&) = delete;
+  TopicSignal& operator=(const TopicSignal&) = delete;
+
+  /**
+   * @brief 获取TopicSignal的单例实例。
+   * @return 单例实例的引用。
+   */
+  static TopicSignal& getInstance();
+
+  /**
+   * @brief 获取话题槽位，不存在时登记一个新的槽位。
+   *
+   * @param topic_name 话题名称，长度不得超过`kTopicSignalNameSize - 1`。
+   * @return 话题槽位指针，共享内存段不可用、名称过长或槽位已满时返回`nullptr`。
+   */
+  TopicSignalSlot* GetSlot(const std::string& topic_name);
+
+  /**
+   * @brief 通知话题已发布新数据。
+   *
+   * @param slot 话题槽位，为`nullptr`时忽略。
+   */
+  void Notify(TopicSignalSlot* slot);
+
+  /**
+   * @brief 获取话题通知共享内存段。
+   *
+   * @return 话题通知共享内存段指针，不可用时返回`nullptr`。
+   */
+  TopicSignalSegment* GetSegment();
+
+ private:
+  /**
+   * @brief 私有构造函数，映射话题通知共享内存段。
+   */
+  TopicSignal();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~TopicSignal() = default;
+
+  std::unique_ptr<SharedMemoryData<TopicSignalSegment>> shm_;  /**< 话题通知共享内存段 */
+  TopicSignalSegment* segment_;                                /**< 话题通知共享内存段指针 */
+  std::unordered_map<std::string, TopicSignalSlot*> slot_map_; /**< 话题名称键的槽位缓存 */
+  std::mutex mutex_;                                           /**< 进程内登记槽位的互斥锁 */
+};
+
+}  // namespace ocm
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "ocm/shard_memory_data.hpp"
+
+namespace ocm {
+
+constexpr uint32_t kExternalClockMagic = 0x4f434d43; /**< 外部时钟共享内存段魔数 "OCMC" */
+
+/**
+ * @brief 外部时钟共享内存段的布局。
+ *
+ * 第`n`个节拍的时间为`epoch_ns + n * tick_period_ns`（`CLOCK_MONOTONIC`纳秒）。
+ * 节拍计数为64位且只增不减，订阅者据此计算释放时刻，可精确得知错过了多少个节拍。
+ */
+struct ExternalClockSegment {
+  std::atomic<uint32_t> magic;          /**< 魔数，时钟源启动后写入 */
+  std::atomic<uint32_t> seq;            /**< 变更序号，同时作为跨进程futex字 */
+  std::atomic<uint32_t> waiters;        /**< 正在等待的订阅者数量，为0时时钟源跳过唤醒系统调用 */
+  std::atomic<uint64_t> tick;           /**< 当前节拍计数 */
+  std::atomic<uint64_t> tick_period_ns; /**< 节拍周期，以纳秒为单位 */
+  std::atomic<int64_t> epoch_ns;        /**< 第0个节拍的时间，`CLOCK_MONOTONIC`纳秒 */
+};
+
+/**
+ * @class ExternalClock
+ * @brief 外部时钟源，向共享内存发布节拍并唤醒`EXTERNAL_TIMER`类型的任务。
+ *
+ * 每个时钟段只允许一个时钟源写入。时钟源重启时沿用已有的节拍计数并重新计算纪元，
+ * 保证订阅者看到的节拍计数始终单调递增。
+ */
+class ExternalClock {
+ public:
+  /**
+   * @brief 创建或接管外部时钟段。
+   *
+   * @param name 时钟段名称。
+   * @param tick_period 节拍周期，以秒为单位。
+   */
+  ExternalClock(const std::string& name, double tick_period);
+
+  /**
+   * @brief 析构函数。
+   */
+  ~ExternalClock() = default;
+
+  /**
+   * @brief 推进一个节拍。
+   */
+  void Tick();
+
+  /**
+   * @brief 发布绝对节拍计数，适用于由硬件计数器驱动的时钟源。
+   *
+   * @param tick 节拍计数，小于当前计数时忽略。
+   */
+  void Publish(uint64_t tick);
+
+  /**
+   * @brief 获取当前节拍计数。
+   *
+   * @return 节拍计数。
+   */
+  uint64_t GetTick() const;
+
+  /**
+   * @brief 获取节拍周期。
+   *
+   * @return 节拍周期，以秒为单位。
+   */
+  double GetTickPeriod() const;
+
+ private:
+  std::unique_ptr<SharedMemoryData<ExternalClockSegment>> shm_; /**< 外部时钟共享内存段 */
+  ExternalClockSegment* segment_;                               /**< 外部时钟共享内存段指针 */
+};
+
+}  // namespace ocm
@@ -136,6 +136,30 @@ inline int set_thread_priority(const pid_t pid, size_t const sched_priority, con
   return sched_setscheduler(pid, policy, &param);
 }
 
+/**
+ * @brief 将线程切换为`SCHED_DEADLINE`调度。
+ *
+ * 内核要求 `runtime <= deadline <= period` 且运行时间不小于1024纳秒，并通过准入控制检查总带宽，
+ * 不满足时返回失败。切换前线程的CPU亲和性须覆盖整个根调度域，否则返回 `EPERM`。
+ *
+ * @param pid 要设置的线程的进程 ID。使用 `0` 表示调用线程。
+ * @param runtime_ns 每周期的运行预算，以纳秒为单位。
+ * @param deadline_ns 相对截止时间，以纳秒为单位。
+ * @param period_ns 周期，以纳秒为单位。
+ *
+ * @return 成功时返回 `0`，失败时返回 `-1` 并相应地设置 `errno`。
+ */
+inline int set_thread_deadline(const pid_t pid, const uint64_t runtime_ns, const uint64_t deadline_ns, const uint64_t period_ns) {
+  sched_attr_t attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.sched_policy = SCHED_DEADLINE;
+  attr.sched_runtime = runtime_ns;
+  attr.sched_deadline = deadline_ns;
+  attr.sched_period = period_ns;
+  return sched_setattr(pid, &attr, 0);
+}
+
 /**
  * @brief 设置线程的CPU亲和性。
  *
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace ocm {
+
+/**
+ * @brief 仿真时钟中的一个周期任务。
+ *
+ * 所有字段均由`SimClock`在其互斥锁保护下读写。
+ */
+struct SimClockEntry {
+  int64_t period_ns = 10000000; /**< 周期，以纳秒为单位 */
+  int64_t phase_ns = 0;         /**< 相位偏移，以纳秒为单位 */
+  int64_t next_release_ns = 0;  /**< 下一次释放的仿真时间 */
+  int64_t release_ns = 0;       /**< 最近一次释放的仿真时间 */
+  uint64_t release_seq = 0;     /**< 释放序号 */
+  uint64_t consumed_seq = 0;    /**< 任务已消费的释放序号 */
+  bool waiting = false;         /**< 任务是否正在等待释放 */
+  bool pending = false;         /**< 任务已被释放或启动，但尚未回到等待 */
+  bool wake = false;            /**< 是否被要求立即唤醒 */
+};
+
+/**
+ * @class SimClock
+ * @brief 以锁步方式推进的进程内仿真时钟。
+ *
+ * 控制者调用`Step`或`StepToNext`推进仿真时间，所有到期的任务各运行一次，
+ * 并在全部回到等待后才返回，因此仿真可以在不依赖真实时间的前提下尽可能快且可复现地运行。
+ * 一旦有`TimerType::SIMULATED`任务登记，仿真时间即在进程内启用，`TimerOnce`与任务的循环计时都改为读取仿真时间。
+ * 同一步内到期的任务在各自线程中并行运行，步与步之间的先后顺序是确定的。
+ */
+class SimClock {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  SimClock(const SimClock&) = delete;
+  SimClock& operator=(const SimClock&) = delete;
+
+  /**
+   * @brief 获取SimClock的单例实例。
+   * @return 单例实例的引用。
+   */
+  static SimClock& getInstance();
+
+  /**
+   * @brief 判断进程内是否启用了仿真时间。
+   *
+   * @return 是否启用。
+   */
+  static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief 获取当前仿真时间。
+   *
+   * @return 仿真时间，以纳秒为单位，从0开始。
+   */
+  int64_t NowNs() const;
+
+  /**
+   * @brief 获取当前仿真时间。
+   *
+   * @return 仿真时间，以秒为单位。
+   */
+  double Now() const;
+
+  /**
+   * @brief 将仿真时间推进`dt`，运行所有到期的任务并等待它们完成。
+   *
+   * 周期小于`dt`的任务在一步内只运行一次，其间的多个释放时刻被合并。
+   *
+   * @param dt 推进的时长，以秒为单位。
+   * @return 推进后的仿真时间，以秒为单位。
+   */
+  double Step(double dt);
+
+  /**
+   * @brief 将仿真时间推进到最近的释放时刻，运行该时刻到期的任务并等待它们完成。
+   *
+   * @return 推进后的仿真时间，以秒为单位，没有等待中的任务时不推进。
+   */
+  double StepToNext();
+
+  /**
+   * @brief 登记任务并启用仿真时间。
+   *
+   * @param entry 任务，调用者负责其生命周期，需在销毁前调用`Unregister`。
+   */
+  void Register(SimClockEntry* entry);
+
+  /**
+   * @brief 注销任务。
+   *
+   * @param entry 任务。
+   */
+  void Unregister(SimClockEntry* entry);
+
+  /**
+   * @brief 设置任务周期。
+   *
+   * @param entry 任务。
+   * @param period 周期，以秒为单位。
+   */
+  void SetPeriod(SimClockEntry* entry, double period);
+
+  /**
+   * @brief 设置任务的相位偏移，下一次释放移动到最近的相位网格点。
+   *
+   * @param entry 任务。
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(SimClockEntry* entry, double phase);
+
+  /**
+   * @brief 标记任务即将启动，控制者在其回到等待前不会推进时间。
+   *
+   * 在调用`TaskStart`的线程中调用，保证启动任务的那一步能够等到新任务就绪。
+   *
+   * @param entry 任务。
+   */
+  void Activate(SimClockEntry* entry);
+
+  /**
+   * @brief 标记任务已退出运行循环。
+   *
+   * @param entry 任务。
+   */
+  void Deactivate(SimClockEntry* entry);
+
+  /**
+   * @brief 重新开始计时，下一次释放在当前仿真时间之后最近的相位网格点。
+   *
+   * @param entry 任务。
+   */
+  void Restart(SimClockEntry* entry);
+
+  /**
+   * @brief 等待任务的下一次释放。
+   *
+   * @param entry 任务。
+   * @return 被释放返回`true`，被`Wake`唤醒返回`false`。
+   */
+  bool Wait(SimClockEntry* entry);
+
+  /**
+   * @brief 立即唤醒等待中的任务。
+   *
+   * @param entry 任务。
+   */
+  void Wake(SimClockEntry* entry);
+
+ private:
+  /**
+   * @brief 私有构造函数。
+   */
+  SimClock();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~SimClock() = default;
+
+  /**
+   * @brief 释放所有到期的等待中任务，并等待它们回到等待。
+   */
+  void ReleaseDue(std::unique_lock<std::mutex>& lock);
+
+  /**
+   * @brief 计算当前仿真时间之后最近的相位网格点。
+   */
+  int64_t NextAligned(const SimClockEntry* entry) const;
+
+  /**
+   * @brief 判断是否仍有已释放或已启动但尚未回到等待的任务。
+   */
+  bool HasPending() const;
+
+  static std::atomic_bool enabled_;     /**< 进程内是否启用了仿真时间 */
+  std::atomic<int64_t> now_ns_;         /**< 当前仿真时间，以纳秒为单位 */
+  std::vector<SimClockEntry*> entries_; /**< 已登记的任务 */
+  std::mutex mutex_;                    /**< 保护任务状态的互斥锁 */
+  std::condition_variable task_cv_;     /**< 任务等待释放的条件变量 */
+  std::condition_variable step_cv_;     /**< 控制者等待任务完成的条件变量 */
+};
+
+}  // namespace ocm
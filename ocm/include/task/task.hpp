@@ -6,6 +6,7 @@
 #include "log_anywhere/log_anywhere.hpp"
 #include "node/node.hpp"
 #include "task/task_base.hpp"
+#include "task/task_graph.hpp"
 
 namespace ocm {
 
@@ -34,18 +35,18 @@ class Task : public TaskBase {
        bool all_cpu_affinity_enable);
 
   /**
-   * @brief 默认析构函数。
+   * @brief 析构函数。
    *
    * @details
-   * 清理 Task 分配的所有资源。
+   * 清理 Task 分配的所有资源，并回收节点依赖图的辅助线程。
    */
-  ~Task() = default;
+  ~Task();
 
   /**
    * @brief 初始化与任务关联的所有节点。
    *
    * @details
-   * 将所有节点的初始化标志设置为 true 并调用 InitNode 执行初始化。
+   * 请求所有节点在下一次运行时初始化，可由其它线程调用。
    * 该方法确保在任务开始执行之前所有节点都已正确设置。
    */
   void Init();
@@ -62,6 +63,13 @@ class Task : public TaskBase {
    */
   std::set<std::string> Init(const std::set<std::string>& init_node_list);
 
+  /**
+   * @brief 按下标初始化与任务关联的特定子集节点，不做名称查找。
+   *
+   * @param init_node_index 要初始化的节点下标，即节点在任务配置`node_list`中的位置。
+   */
+  void Init(const std::vector<size_t>& init_node_index);
+
   /**
    * @brief 通过运行并可选择性地输出每个节点来执行任务。
    *
@@ -71,6 +79,63 @@ class Task : public TaskBase {
    */
   void Run() override;
 
+  /**
+   * @brief 声明节点之间的数据依赖，并按依赖图并行执行节点。
+   *
+   * @details
+   * 每个周期中节点只等待其依赖的节点完成，相互独立的节点在任务线程与辅助线程上并行运行，
+   * 所有节点完成后本周期结束。未出现在 `depend` 中的节点没有依赖。需在 `TaskStart` 之前调用。
+   *
+   * @param depend 节点名称到其依赖的节点名称列表的映射。
+   *
+   * @throws std::runtime_error 如果依赖的节点不属于该任务或依赖关系中存在环。
+   */
+  void SetNodeDepend(const std::unordered_map<std::string, std::vector<std::string>>& depend);
+
+  /**
+   * @brief 设置节点的分频运行方式。
+   *
+   * @details
+   * 节点每`rate_divisor`个任务周期运行一次，在周期计数满足`tick % rate_divisor == rate_phase`的周期运行，
+   * 其余周期跳过该节点（依赖图中的后继节点照常运行，读取其上一次的输出）。`rate_phase`为-1时由`BalanceNodePhase`自动分配。
+   *
+   * @param node_name 节点名称。
+   * @param rate_divisor 分频系数，不小于1。
+   * @param rate_phase 分频相位，取值为[0, rate_divisor)，-1表示自动分配。
+   *
+   * @throws std::runtime_error 如果节点不属于该任务或参数越界。
+   */
+  void SetNodeRate(const std::string& node_name, int rate_divisor, int rate_phase = -1);
+
+  /**
+   * @brief 为自动相位的分频节点重新分配相位，使各周期的负载尽量均衡。
+   *
+   * @details
+   * 以各分频系数的最小公倍数为超周期统计每个周期的负载，按耗时从大到小依次为节点选择峰值负载最小的相位。
+   * 所有节点都已有耗时统计样本时以执行耗时p99作为负载，否则视每个节点的负载相同。可在任务运行中调用，
+   * 相位切换时节点可能在一个分频周期内少运行或多运行一次。只有相位发生变化的节点才会记录日志。
+   */
+  void BalanceNodePhase();
+
+  /**
+   * @brief 启用或关闭节点耗时统计。
+   *
+   * @details
+   * 启用后任务在每个周期中分别记录每个节点构造、初始化、执行与输出的耗时，写入节点的耗时直方图与最长耗时记录，
+   * 并导出到共享内存监控段；关闭时每个节点只多一次原子读取。可在任务运行中随时切换。
+   *
+   * @param profile_enable 是否启用节点耗时统计。
+   */
+  void SetProfileEnable(bool profile_enable);
+
+  /**
+   * @brief 获取节点的耗时统计。
+   *
+   * @param node_name 节点名称。
+   * @return 节点耗时统计指针，节点不属于该任务或从未启用耗时统计时返回`nullptr`。
+   */
+  const NodeProfile* GetNodeProfile(const std::string& node_name) const;
+
   /**
    * @brief 获取任务的配置设置。
    *
@@ -83,23 +148,40 @@ class Task : public TaskBase {
 
  private:
   /**
-   * @brief 根据节点的初始化标志初始化节点。
+   * @brief 执行计划中的单个节点。
    *
    * @details
-   * 该方法遍历节点列表，初始化每个初始化标志设置为 true 的节点。
-   * 它调用每个节点的 Init 和 RunOnce 方法，并在启用时处理它们的输出。
+   * 构造时按节点列表顺序预先生成，运行时按下标访问，不再按节点名称查找。
+   */
+  struct NodePlan {
+    NodeBase* node;                   /**< 节点指针，节点由`node_list_`持有 */
+    bool output_enable;               /**< 是否输出节点数据 */
+    std::atomic_bool init_request;    /**< 是否请求在下一次运行时初始化节点，可由其它线程设置 */
+    uint32_t rate_divisor;            /**< 分频系数 */
+    std::atomic<uint32_t> rate_phase; /**< 分频相位，可由其它线程重新分配 */
+    bool auto_phase;                  /**< 分频相位是否自动分配 */
+    uint32_t trace_execute;           /**< 节点执行的跟踪事件名称序号 */
+    uint32_t trace_output;            /**< 节点输出的跟踪事件名称序号 */
+  };
+
+  /**
+   * @brief 运行单个节点：必要时构造与初始化，然后执行并按需输出。
    *
-   * @param node_init_flag 包含节点名称及其初始化状态的映射。
+   * @param index 节点在节点列表中的下标。
    */
-  void InitNode(const std::unordered_map<std::string, bool>& node_init_flag);
+  void RunNode(size_t index);
 
   /**
-   * @brief 用于跟踪每个节点是否应输出数据的映射。
+   * @brief 校验并记录节点的分频系数与相位，不重新分配自动相位。
    *
-   * @details
-   * 键是节点的名称，值指示该节点是否启用了输出。
+   * @param node_name 节点名称。
+   * @param rate_divisor 分频系数，不小于1。
+   * @param rate_phase 分频相位，取值为[0, rate_divisor)，-1表示自动分配。
+   * @return 节点是否需要自动分配相位。
+   *
+   * @throws std::runtime_error 如果节点不属于该任务或参数越界。
    */
-  std::unordered_map<std::string, bool> node_output_flag_;
+  bool ApplyNodeRate(const std::string& node_name, int rate_divisor, int rate_phase);
 
   /**
    * @brief 任务的配置设置。
@@ -110,12 +192,14 @@ class Task : public TaskBase {
   TaskSetting task_setting_;
 
   /**
-   * @brief 用于跟踪每个节点是否已初始化的映射。
+   * @brief 节点执行计划，与节点列表一一对应。
    *
    * @details
-   * 键是节点的名称，值指示该节点是否已初始化。
+   * 每项包含节点指针、输出标志与原子的初始化请求，热路径上只按下标顺序访问。
    */
-  std::unordered_map<std::string, bool> node_init_flag_;
+  std::unique_ptr<NodePlan[]> plan_;
+
+  std::unordered_map<std::string, size_t> node_index_; /**< 节点名称到执行计划下标的映射，仅在冷路径上使用 */
 
   /**
    * @brief 关联任务的节点列表的共享指针。
@@ -124,6 +208,19 @@ class Task : public TaskBase {
    * 列表中的每个节点代表任务管理和执行的不同组件或进程。
    */
   std::shared_ptr<std::vector<std::shared_ptr<NodeBase>>> node_list_;
+
+  /**
+   * @brief 节点依赖图的并行执行器。
+   *
+   * @details
+   * 未声明依赖图时为空，节点按配置顺序在任务线程中依次运行。
+   */
+  std::unique_ptr<TaskGraph> graph_;
+
+  bool all_priority_enable_;        /**< 辅助线程是否启用优先级设置 */
+  bool all_cpu_affinity_enable_;    /**< 辅助线程是否启用CPU亲和性设置 */
+  std::atomic_bool profile_enable_; /**< 是否启用节点耗时统计 */
+  uint64_t tick_;                   /**< 任务周期计数，仅由任务线程在每个周期结束时递增 */
 };
 
 }  // namespace ocm
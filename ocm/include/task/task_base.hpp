@@ -6,11 +6,18 @@
 #include <semaphore>
 #include <thread>
 #include "common/enum.hpp"
+#include "common/histogram.hpp"
 #include "common/struct_type.hpp"
 #include "log_anywhere/log_anywhere.hpp"
+#include "monitor/monitor.hpp"
 #include "ocm/shard_memory_data.hpp"
 #include "ocm/shared_memory_semaphore.hpp"
+#include "ocm/topic_signal.hpp"
+#include "task/external_clock.hpp"
+#include "task/sim_clock.hpp"
 #include "task/timer.hpp"
+#include "task/timer_service.hpp"
+#include "task/worker_pool.hpp"
 
 namespace ocm {
 
@@ -54,6 +61,92 @@ class SleepBase {
    */
   virtual double GetPeriod() const { return 0; }
 
+  /**
+   * @brief 设置周期内的相位偏移。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  virtual void SetPhase(double phase) {}
+
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略。
+   */
+  virtual void SetOverrunPolicy(OverrunPolicy policy) {}
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  virtual void SetMissCallback(DeadlineMissCallback callback) {}
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数，不支持检测的睡眠机制返回0。
+   */
+  virtual uint64_t GetMissCount() const { return 0; }
+
+  /**
+   * @brief 任务开始运行前重新开始计时，丢弃待命期间累积的到期。
+   */
+  virtual void Restart() {}
+
+  /**
+   * @brief 获取最近一次唤醒对应的计划释放时间。
+   *
+   * @return 计划释放时间，`CLOCK_MONOTONIC`纳秒，无法得知时返回0。
+   */
+  virtual int64_t GetReleaseNs() const { return 0; }
+
+  /**
+   * @brief 设置是否在每次作业结束、进入睡眠前调用`sched_yield`。
+   *
+   * 线程处于`SCHED_DEADLINE`调度时，`sched_yield`会放弃本周期剩余的运行预算，通知内核当前作业已完成。
+   *
+   * @param enable 是否启用。
+   */
+  virtual void SetYieldOnComplete(bool enable) {}
+
+  /**
+   * @brief 设置自旋余量。
+   *
+   * @param margin 自旋余量，以秒为单位。
+   * @param auto_calibrate 是否根据观测到的唤醒延迟自动校准。
+   */
+  virtual void SetSpinMargin(double margin, bool auto_calibrate) {}
+
+  /**
+   * @brief 获取当前的自旋余量。
+   *
+   * @return 自旋余量，以秒为单位，不自旋的睡眠机制返回0。
+   */
+  virtual double GetSpinMargin() const { return 0; }
+
+  /**
+   * @brief 设置绑定的话题与触发策略。
+   *
+   * @param topics 话题名称列表。
+   * @param policy 绑定多个话题时的触发策略。
+   * @param timeout 超时时间，以秒为单位，小于等于0时无限等待。
+   * @param timeout_miss 超时是否计为一次错过截止时间。
+   * @param timeout_aligned 超时截止时间是否对齐到以超时时间为周期的绝对网格。
+   */
+  virtual void SetTriggerTopics(const std::vector<std::string>& topics, TriggerPolicy policy, double timeout, bool timeout_miss,
+                                bool timeout_aligned) {}
+
+  /**
+   * @brief 任务启动时在调用`TaskStart`的线程中调用。
+   */
+  virtual void Activate() {}
+
+  /**
+   * @brief 任务线程退出运行循环时调用。
+   */
+  virtual void Deactivate() {}
+
   /**
    * @brief 继续或恢复睡眠机制。
    */
@@ -102,33 +195,115 @@ class SleepInternalTimer : public SleepBase {
    */
   double GetPeriod() const override;
 
+  /**
+   * @brief 设置周期内的相位偏移，唤醒时间对齐到`CLOCK_MONOTONIC`上的相位网格。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
   /**
    * @brief 继续或重置内部定时器时钟。
    */
   void Continue() override;
 
- private:
-  TimerLoop timer_loop_; /**< 内部定时器循环，用于管理睡眠间隔 */
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy) override;
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  void SetMissCallback(DeadlineMissCallback callback) override;
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数。
+   */
+  uint64_t GetMissCount() const override;
+
+  /**
+   * @brief 以当前时间为起点重新开始计时。
+   */
+  void Restart() override;
+
+  /**
+   * @brief 获取最近一次唤醒对应的计划释放时间。
+   *
+   * @return 计划释放时间，`CLOCK_MONOTONIC`纳秒。
+   */
+  int64_t GetReleaseNs() const override;
+
+  /**
+   * @brief 设置是否在每次作业结束、进入睡眠前调用`sched_yield`。
+   *
+   * @param enable 是否启用。
+   */
+  void SetYieldOnComplete(bool enable) override;
+
+ protected:
+  TimerLoop timer_loop_;   /**< 内部定时器循环，用于管理睡眠间隔 */
+  bool yield_on_complete_; /**< 是否在睡眠前放弃剩余的运行预算 */
 };
 
 /**
- * @brief 使用外部定时器的睡眠机制。
+ * @brief 先睡眠后自旋的内部定时器睡眠机制。
  *
- * `SleepExternalTimer`类使用信号量和共享内存等外部同步原语实现了`SleepBase`接口。
+ * `SleepHybridSpin`先用`clock_nanosleep`睡眠到截止时间前的自旋余量处，再自旋等待到截止时间，
+ * 适用于周期低于100微秒、唤醒延迟不可接受的任务。自旋余量根据观测到的唤醒延迟自动校准，
+ * 实际达到的抖动体现在任务的唤醒延迟统计中。
+ */
+class SleepHybridSpin : public SleepInternalTimer {
+ public:
+  /**
+   * @brief 构造一个`SleepHybridSpin`实例，使用默认的自旋余量并启用自动校准。
+   */
+  SleepHybridSpin();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~SleepHybridSpin() = default;
+
+  /**
+   * @brief 设置自旋余量。
+   *
+   * @param margin 自旋余量，以秒为单位。
+   * @param auto_calibrate 是否根据观测到的唤醒延迟自动校准。
+   */
+  void SetSpinMargin(double margin, bool auto_calibrate) override;
+
+  /**
+   * @brief 获取当前的自旋余量。
+   *
+   * @return 自旋余量，以秒为单位。
+   */
+  double GetSpinMargin() const override;
+};
+
+/**
+ * @brief 使用外部时钟的睡眠机制。
  *
- * 它允许外部实体触发睡眠的继续。
+ * `SleepExternalTimer`订阅由`ExternalClock`发布的共享内存时钟段，按节拍计数计算释放时刻，
+ * 在跨进程futex上等待节拍到达，无需每个任务各自的信号量。周期按节拍四舍五入且至少为1个节拍，
+ * 运行结束时节拍计数已达到下一个释放时刻即判定为错过截止时间，错过的周期数由节拍计数精确得出。
  */
 class SleepExternalTimer : public SleepBase {
  public:
   /**
    * @brief 构造一个`SleepExternalTimer`实例。
    *
-   * 初始化用于外部定时器同步的信号量和共享内存。
+   * 映射外部时钟段，时钟源尚未启动时将在第一次睡眠时等待其启动。
    *
-   * @param sem_name 信号量名称。
-   * @param shm_name 共享内存段名称。
+   * @param clock_name 外部时钟段名称。
    */
-  SleepExternalTimer(const std::string& sem_name, const std::string& shm_name);
+  SleepExternalTimer(const std::string& clock_name);
 
   /**
    * @brief 析构函数。
@@ -136,37 +311,106 @@ class SleepExternalTimer : public SleepBase {
   ~SleepExternalTimer() = default;
 
   /**
-   * @brief 使线程睡眠，直到外部定时器发出继续信号。
+   * @brief 使线程睡眠，直到外部时钟到达下一个释放节拍。
    *
    * @param duration 睡眠的持续时间，以秒为单位。默认为0。
    */
   void Sleep(double duration = 0) override;
 
   /**
-   * @brief 根据外部定时器的间隔设置睡眠周期。
+   * @brief 设置睡眠周期，下一次睡眠时以当前节拍为起点重新计时。
    *
    * @param period 周期，以秒为单位。
    */
   void SetPeriod(double period) override;
 
   /**
-   * @brief 获取基于外部定时器间隔的当前睡眠周期。
+   * @brief 获取按节拍取整后的睡眠周期。
    *
-   * @return 睡眠周期，以秒为单位。
+   * @return 睡眠周期，以毫秒为单位。
    */
   double GetPeriod() const override;
 
   /**
-   * @brief 继续或重置外部定时器。
+   * @brief 设置周期内的相位偏移，释放节拍满足`(tick - phase) % period == 0`。
+   *
+   * 相位按节拍四舍五入，可在运行时从其它线程调用，下一次睡眠时重新对齐。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
+  /**
+   * @brief 立即唤醒睡眠中的线程。
    */
   void Continue() override;
 
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy) override;
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  void SetMissCallback(DeadlineMissCallback callback) override;
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数。
+   */
+  uint64_t GetMissCount() const override;
+
+  /**
+   * @brief 以当前节拍为起点重新开始计时。
+   */
+  void Restart() override;
+
+  /**
+   * @brief 获取最近一次释放节拍对应的时间。
+   *
+   * @return 释放时间，`CLOCK_MONOTONIC`纳秒，尚未释放时返回0。
+   */
+  int64_t GetReleaseNs() const override;
+
  private:
-  uint8_t dt_;                     /**< 定时器间隔增量 */
-  std::atomic_int interval_time_;  /**< 等待的间隔数量 */
-  std::atomic_int interval_count_; /**< 已等待间隔的计数器 */
-  SharedMemorySemaphore sem_;      /**< 用于外部同步的信号量 */
-  SharedMemoryData<uint8_t> shm_;  /**< 定时器数据的共享内存段 */
+  /**
+   * @brief 读取时钟段的节拍周期并更新以节拍为单位的任务周期。
+   *
+   * @return 时钟源是否已启动。
+   */
+  bool UpdatePeriodTicks();
+
+  /**
+   * @brief 在时钟段的futex上等待，直到条件满足或被`Continue`唤醒。
+   *
+   * @param ready 等待条件。
+   * @return 条件满足返回`true`，被`Continue`唤醒返回`false`。
+   */
+  bool WaitFor(const std::function<bool()>& ready);
+
+  std::unique_ptr<SharedMemoryData<ExternalClockSegment>> shm_; /**< 外部时钟共享内存段 */
+  ExternalClockSegment* segment_;                               /**< 外部时钟共享内存段指针 */
+  double period_;                                               /**< 期望周期，以秒为单位 */
+  std::atomic<double> phase_;                                   /**< 期望相位偏移，以秒为单位 */
+  std::atomic_bool phase_changed_;                              /**< 相位是否被修改，需在下一次睡眠时重新对齐 */
+  uint64_t tick_period_ns_;                                     /**< 最近读取的节拍周期，以纳秒为单位 */
+  uint64_t period_ticks_;                                       /**< 周期，以节拍为单位 */
+  uint64_t phase_ticks_;                                        /**< 相位偏移，以节拍为单位 */
+  uint64_t next_tick_;                                          /**< 下一次释放的节拍 */
+  uint64_t release_tick_;                                       /**< 最近一次释放的节拍 */
+  uint64_t miss_reported_tick_;                                 /**< 已作为错过截止时间上报的最晚释放节拍 */
+  bool started_;                                                /**< 是否已按当前节拍开始计时 */
+  bool released_;                                               /**< 是否已有过释放 */
+  std::atomic_bool continue_;                                   /**< 是否被要求立即唤醒 */
+  OverrunPolicy overrun_policy_;                                /**< 错过截止时间后的处理策略 */
+  DeadlineMissCallback miss_callback_;                          /**< 错过截止时间时的回调函数 */
+  std::atomic<uint64_t> miss_count_;                            /**< 错过截止时间的次数 */
 };
 
 /**
@@ -208,6 +452,375 @@ class SleepTrigger : public SleepBase {
   SharedMemorySemaphore sem_; /**< 用于睡眠同步的信号量 */
 };
 
+/**
+ * @brief 由共享内存话题发布触发的睡眠机制。
+ *
+ * `SleepTopicTrigger`类在`TopicSignal`共享内存段中等待绑定话题的发布通知，数据到达后立即唤醒任务，
+ * 不消耗话题自身的信号量，因此可与该话题的普通订阅者共存。超时未触发时照常唤醒任务并计为一次错过截止时间。
+ */
+class SleepTopicTrigger : public SleepBase {
+ public:
+  /**
+   * @brief 构造一个`SleepTopicTrigger`实例。
+   *
+   * 绑定的话题需在任务启动前通过`SetTriggerTopics`设置。
+   */
+  SleepTopicTrigger();
+
+  /**
+   * @brief 析构函数。
+   */
+  ~SleepTopicTrigger() = default;
+
+  /**
+   * @brief 使线程睡眠，直到绑定的话题按触发策略发布了新数据、超时或被`Continue`唤醒。
+   *
+   * @param duration 睡眠的持续时间，以秒为单位。默认为0。
+   */
+  void Sleep(double duration = 0) override;
+
+  /**
+   * @brief 设置绑定的话题与触发策略，需在任务启动前调用。
+   *
+   * @param topics 话题名称列表。
+   * @param policy 绑定多个话题时的触发策略。
+   * @param timeout 超时时间，以秒为单位，小于等于0时无限等待。
+   * @param timeout_miss 超时是否计为一次错过截止时间，以超时作为周期性唤醒时应设为`false`。
+   * @param timeout_aligned 为`false`时截止时间为每次睡眠开始后的`timeout`；为`true`时截止时间为下一个满足
+   *                        `(t - phase) % timeout == 0`的`CLOCK_MONOTONIC`时刻，被话题提前唤醒也不会使周期性唤醒偏离网格。
+   *
+   * @throws std::runtime_error 如果话题列表为空或话题通知共享内存段不可用。
+   */
+  void SetTriggerTopics(const std::vector<std::string>& topics, TriggerPolicy policy, double timeout, bool timeout_miss,
+                        bool timeout_aligned) override;
+
+  /**
+   * @brief 设置对齐超时网格的相位偏移，仅在超时对齐时生效。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
+  /**
+   * @brief 立即唤醒睡眠中的线程。
+   */
+  void Continue() override;
+
+  /**
+   * @brief 设置超时时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  void SetMissCallback(DeadlineMissCallback callback) override;
+
+  /**
+   * @brief 获取超时的次数。
+   *
+   * @return 超时的次数。
+   */
+  uint64_t GetMissCount() const override;
+
+  /**
+   * @brief 丢弃待命期间的发布与唤醒请求，只等待启动之后的新数据。
+   */
+  void Restart() override;
+
+  /**
+   * @brief 获取触发本次唤醒的发布时间，超时唤醒时为超时时刻。
+   *
+   * @return 发布时间，`CLOCK_MONOTONIC`纳秒，尚未触发时返回0。
+   */
+  int64_t GetReleaseNs() const override;
+
+ private:
+  TopicSignalSegment* segment_;         /**< 话题通知共享内存段指针 */
+  std::vector<TopicSignalSlot*> slots_; /**< 绑定的话题槽位 */
+  std::vector<uint32_t> seen_seq_;      /**< 各话题已消费的发布序号 */
+  uint32_t epoch_mask_;                 /**< 在`epoch`上等待时使用的futex位集合，为绑定话题位的并集 */
+  TriggerPolicy policy_;                /**< 触发策略 */
+  int64_t timeout_ns_;                  /**< 超时时间，以纳秒为单位，0表示无限等待 */
+  bool timeout_miss_;                   /**< 超时是否计为错过截止时间 */
+  bool timeout_aligned_;                /**< 超时截止时间是否对齐到绝对网格 */
+  std::atomic<int64_t> phase_ns_;       /**< 超时网格的相位偏移，以纳秒为单位 */
+  int64_t release_ns_;                  /**< 最近一次唤醒对应的发布时间 */
+  std::atomic_bool continue_;           /**< 是否被要求立即唤醒 */
+  DeadlineMissCallback miss_callback_;  /**< 超时时的回调函数 */
+  std::atomic<uint64_t> miss_count_;    /**< 超时的次数 */
+};
+
+/**
+ * @brief 使用进程内定时器服务的睡眠机制。
+ *
+ * `SleepTimerService`类将任务的周期登记到`TimerService`的时间轮中，
+ * 由单个时钟线程在到期节拍通过futex直接唤醒，取代每个任务各自的`clock_nanosleep`。
+ */
+class SleepTimerService : public SleepBase {
+ public:
+  /**
+   * @brief 构造一个`SleepTimerService`实例。
+   */
+  SleepTimerService();
+
+  /**
+   * @brief 析构函数，将定时器移出时间轮。
+   */
+  ~SleepTimerService();
+
+  /**
+   * @brief 使线程睡眠直到定时器下一次到期。
+   *
+   * 若上次唤醒后定时器已到期（任务超时），则立即返回。
+   *
+   * @param duration 睡眠的持续时间，以秒为单位。默认为0。
+   */
+  void Sleep(double duration = 0) override;
+
+  /**
+   * @brief 设置定时器周期。
+   *
+   * 可在任务运行期间由其它线程调用，新周期由任务线程在下一次睡眠时重新调度生效。
+   *
+   * @param period 周期，以秒为单位。
+   */
+  void SetPeriod(double period) override;
+
+  /**
+   * @brief 获取定时器周期。
+   *
+   * @return 周期，以毫秒为单位。
+   */
+  double GetPeriod() const override;
+
+  /**
+   * @brief 设置相位偏移。
+   *
+   * 可在任务运行期间由其它线程调用，新相位由任务线程在下一次睡眠时重新调度生效。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
+  /**
+   * @brief 立即唤醒睡眠中的线程。
+   */
+  void Continue() override;
+
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * `RESTART`以错过截止时间时的节拍为起点重新对齐周期网格，此后直到重新设置相位前不再保持配置的相位。
+   *
+   * @param policy 超限策略。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy) override;
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  void SetMissCallback(DeadlineMissCallback callback) override;
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数。
+   */
+  uint64_t GetMissCount() const override;
+
+  /**
+   * @brief 丢弃待命期间累积的到期。
+   */
+  void Restart() override;
+
+  /**
+   * @brief 获取最近一次到期的计划节拍时间。
+   *
+   * @return 计划节拍时间，`CLOCK_MONOTONIC`纳秒。
+   */
+  int64_t GetReleaseNs() const override;
+
+ private:
+  TimerServiceEntry entry_;            /**< 时间轮中的定时器 */
+  uint32_t last_seq_;                  /**< 已消费的到期序号 */
+  uint32_t miss_reported_seq_;         /**< 已作为错过截止时间上报的最晚到期序号 */
+  OverrunPolicy overrun_policy_;       /**< 错过截止时间后的处理策略 */
+  DeadlineMissCallback miss_callback_; /**< 错过截止时间时的回调函数 */
+  std::atomic<uint64_t> miss_count_;   /**< 错过截止时间的次数 */
+  std::atomic<double> period_;         /**< 期望周期，以秒为单位 */
+  std::atomic<double> phase_;          /**< 期望相位偏移，以秒为单位 */
+  std::atomic_bool timing_changed_;    /**< 周期或相位是否被修改，需在下一次睡眠时重新调度 */
+};
+
+/**
+ * @brief 使用仿真时钟的睡眠机制。
+ *
+ * `SleepSimulated`将任务登记到`SimClock`，由控制者推进仿真时间时释放，
+ * 任务运行结束回到睡眠后控制者才会继续推进，从而以锁步方式尽可能快地运行。
+ */
+class SleepSimulated : public SleepBase {
+ public:
+  /**
+   * @brief 构造一个`SleepSimulated`实例，登记到仿真时钟并启用仿真时间。
+   */
+  SleepSimulated();
+
+  /**
+   * @brief 析构函数，从仿真时钟注销。
+   */
+  ~SleepSimulated();
+
+  /**
+   * @brief 使线程睡眠直到仿真时钟释放本任务。
+   *
+   * @param duration 睡眠的持续时间，以秒为单位。默认为0。
+   */
+  void Sleep(double duration = 0) override;
+
+  /**
+   * @brief 设置仿真周期。
+   *
+   * @param period 周期，以秒为单位。
+   */
+  void SetPeriod(double period) override;
+
+  /**
+   * @brief 获取仿真周期。
+   *
+   * @return 周期，以毫秒为单位。
+   */
+  double GetPeriod() const override;
+
+  /**
+   * @brief 设置周期内的相位偏移，释放时刻满足`(t - phase) % period == 0`（仿真时间）。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
+  /**
+   * @brief 立即唤醒睡眠中的线程。
+   */
+  void Continue() override;
+
+  /**
+   * @brief 以当前仿真时间为起点重新开始计时，下一次释放在最近的相位网格点。
+   */
+  void Restart() override;
+
+  /**
+   * @brief 标记任务即将启动，控制者在其进入睡眠前不会推进时间。
+   */
+  void Activate() override;
+
+  /**
+   * @brief 标记任务已退出运行循环。
+   */
+  void Deactivate() override;
+
+ private:
+  SimClockEntry entry_; /**< 仿真时钟中的任务 */
+  double period_;       /**< 周期，以秒为单位 */
+};
+
+/**
+ * @brief 在共享工作线程池中运行的睡眠机制。
+ *
+ * `SleepWorkerPool`将非实时任务登记为`WorkerPool`中的周期作业，任务不再拥有独立线程，
+ * 由工作线程在释放时刻到达后按截止时间顺序调用作业，因此`Sleep`不会被调用。
+ */
+class SleepWorkerPool : public SleepBase {
+ public:
+  /**
+   * @brief 构造一个`SleepWorkerPool`实例并登记作业，使用默认的0.01秒周期。
+   *
+   * @param run 作业的一次运行。
+   * @param start_delay 激活后到第一次释放的最短延迟，以秒为单位。
+   */
+  SleepWorkerPool(std::function<void()> run, double start_delay);
+
+  /**
+   * @brief 析构函数，注销作业并等待正在运行的作业结束。
+   */
+  ~SleepWorkerPool();
+
+  /**
+   * @brief 作业由工作线程调度，不会被调用。
+   *
+   * @param duration 睡眠的持续时间，以秒为单位。默认为0。
+   */
+  void Sleep(double duration = 0) override {}
+
+  /**
+   * @brief 设置作业周期。
+   *
+   * @param period 周期，以秒为单位。
+   */
+  void SetPeriod(double period) override;
+
+  /**
+   * @brief 获取作业周期。
+   *
+   * @return 周期，以毫秒为单位。
+   */
+  double GetPeriod() const override;
+
+  /**
+   * @brief 设置作业的相位偏移。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase) override;
+
+  /**
+   * @brief 作业没有睡眠中的线程，无需唤醒。
+   */
+  void Continue() override {}
+
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy) override;
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数。
+   */
+  void SetMissCallback(DeadlineMissCallback callback) override;
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数。
+   */
+  uint64_t GetMissCount() const override;
+
+  /**
+   * @brief 获取正在运行或最近一次运行的作业对应的释放时间。
+   *
+   * @return 释放时间，`CLOCK_MONOTONIC`纳秒。
+   */
+  int64_t GetReleaseNs() const override;
+
+  /**
+   * @brief 开始调度作业。
+   */
+  void Activate() override;
+
+  /**
+   * @brief 停止调度作业，并等待正在运行的作业结束。
+   */
+  void Deactivate() override;
+
+ private:
+  WorkerPoolJob job_; /**< 工作线程池中的作业 */
+  double period_;     /**< 周期，以秒为单位 */
+  double phase_;      /**< 相位偏移，以秒为单位 */
+};
+
 /**
  * @brief 抽象的任务基类。
  *
@@ -223,12 +836,17 @@ class TaskBase {
    * 使用指定的参数初始化任务并创建任务线程。
    *
    * @param thread_name 任务线程名称。
-   * @param type 要使用的定时器类型（`TimerType::INTERNAL_TIMER`，`TimerType::EXTERNAL_TIMER`，`TimerType::TRIGGER`）。
+   * @param type 要使用的定时器类型（`TimerType::INTERNAL_TIMER`，`TimerType::EXTERNAL_TIMER`，`TimerType::TRIGGER`，`TimerType::TIMER_SERVICE`，
+   * `TimerType::HYBRID_SPIN`，`TimerType::SIMULATED`，`TimerType::TOPIC_TRIGGER`）。
    * @param sleep_duration 睡眠机制的持续时间，以秒为单位。
    * @param all_priority_enable 启用所有优先级设置的标志。
    * @param all_cpu_affinity_enable 启用所有CPU亲和性设置的标志。
+   * @param clock_name `TimerType::EXTERNAL_TIMER`订阅的外部时钟段名称，为空时使用任务线程名称。
+   * @param real_time 是否为实时任务。非实时的`TimerType::INTERNAL_TIMER`、`TimerType::HYBRID_SPIN`与`TimerType::TIMER_SERVICE`任务
+   * 不创建独立线程，而是作为作业在共享的`WorkerPool`中运行，系统设置不再作用于任务本身。
    */
-  TaskBase(const std::string& thread_name, TimerType type, double sleep_duration, bool all_priority_enable, bool all_cpu_affinity_enable);
+  TaskBase(const std::string& thread_name, TimerType type, double sleep_duration, bool all_priority_enable, bool all_cpu_affinity_enable,
+           const std::string& clock_name = "", bool real_time = true);
 
   /**
    * @brief 虚析构函数。
@@ -263,6 +881,88 @@ class TaskBase {
    */
   void SetPeriod(double period);
 
+  /**
+   * @brief 设置任务在周期内的相位偏移。
+   *
+   * 仅对支持相位的睡眠机制生效。
+   *
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetPhase(double phase);
+
+  /**
+   * @brief 设置任务错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy);
+
+  /**
+   * @brief 设置任务错过截止时间时的回调函数。
+   *
+   * 回调在任务线程中调用，需在`TaskStart`之前设置。
+   *
+   * @param callback 回调函数，参数为检测到错过时已经过去的周期数量。
+   */
+  void SetMissCallback(DeadlineMissCallback callback);
+
+  /**
+   * @brief 获取任务错过截止时间的次数。
+   *
+   * @return 错过截止时间的次数。
+   */
+  uint64_t GetMissCount() const;
+
+  /**
+   * @brief 设置`TimerType::HYBRID_SPIN`任务的自旋余量。
+   *
+   * @param margin 自旋余量，以秒为单位。
+   * @param auto_calibrate 是否根据观测到的唤醒延迟自动校准，默认启用。
+   */
+  void SetSpinMargin(double margin, bool auto_calibrate = true);
+
+  /**
+   * @brief 获取任务当前的自旋余量。
+   *
+   * @return 自旋余量，以秒为单位，非`TimerType::HYBRID_SPIN`任务返回0。
+   */
+  double GetSpinMargin() const;
+
+  /**
+   * @brief 设置`TimerType::TOPIC_TRIGGER`任务绑定的话题与触发策略。
+   *
+   * 需在`TaskStart`之前调用，超时未触发时照常运行并计为一次错过截止时间。
+   *
+   * @param topics 话题名称列表。
+   * @param policy 绑定多个话题时的触发策略，默认任意一个话题有新数据即触发。
+   * @param timeout 超时时间，以秒为单位，小于等于0时无限等待。
+   * @param timeout_miss 超时是否计为一次错过截止时间，默认计入。
+   * @param timeout_aligned 超时截止时间是否对齐到以超时时间为周期、以任务相位为偏移的绝对网格，默认从每次睡眠开始计时。
+   */
+  void SetTriggerTopics(const std::vector<std::string>& topics, TriggerPolicy policy = TriggerPolicy::ANY_OF, double timeout = 0,
+                        bool timeout_miss = true, bool timeout_aligned = false);
+
+  /**
+   * @brief 获取唤醒延迟（实际唤醒时间减去计划释放时间）的统计摘要。
+   *
+   * 无法得知计划释放时间的睡眠机制（外部定时器、触发器）不记录唤醒延迟，话题触发器记录从话题发布到任务唤醒的延迟。
+   *
+   * @return 唤醒延迟的统计摘要，以纳秒为单位。
+   */
+  HistogramSummary GetWakeLatencySummary() const;
+
+  /**
+   * @brief 获取运行耗时的统计摘要。
+   *
+   * @return 运行耗时的统计摘要，以纳秒为单位。
+   */
+  HistogramSummary GetRunTimeSummary() const;
+
+  /**
+   * @brief 清空唤醒延迟与运行耗时的统计。
+   */
+  void ResetTimingStats();
+
   /**
    * @brief 获取任务的名称。
    *
@@ -313,10 +1013,24 @@ class TaskBase {
    */
   void Loop();
 
+  /**
+   * @brief 运行一次任务并记录计时统计。
+   *
+   * 独立线程在每次睡眠返回后调用，非实时任务由工作线程在作业释放时调用。
+   */
+  void RunOnce();
+
+  /**
+   * @brief 设置任务状态，状态变化时通过`StateNotifier`通知等待者。
+   *
+   * @param state 新的任务状态。
+   */
+  void SetState(TaskState state);
+
   /**
    * @brief 设置线程的实时配置。
    *
-   * 应用诸如优先级和CPU亲和性等系统设置。
+   * 应用诸如优先级和CPU亲和性等系统设置，调度策略为`SchedPolicy::DEADLINE`时通过`sched_setattr`切换为截止时间调度。
    *
    * @param system_setting 要应用的系统设置。
    */
@@ -327,10 +1041,14 @@ class TaskBase {
   std::binary_semaphore start_sem_;   /**< 用于信号任务开始的信号量 */
   int task_id_;                       /**< 任务的标识符 */
   std::string thread_name_;           /**< 任务线程的名称 */
+  uint32_t trace_name_;               /**< 任务运行的跟踪事件名称序号 */
   std::thread thread_;                /**< 任务线程 */
   std::atomic<double> run_duration_;  /**< 上次运行的持续时间 */
   std::atomic<double> loop_duration_; /**< 上次循环的持续时间 */
   std::atomic_bool run_flag_;         /**< 标志，指示任务是否应运行 */
+  bool pooled_;                       /**< 任务是否作为作业在共享工作线程池中运行 */
+  TimerOnce loop_timer_;              /**< 循环计时器 */
+  TimerOnce run_timer_;               /**< 运行计时器 */
 
   std::unique_ptr<SleepBase> timer_; /**< 任务使用的睡眠机制 */
   double sleep_duration_;            /**< 睡眠机制的持续时间，以秒为单位 */
@@ -341,6 +1059,12 @@ class TaskBase {
 
   bool all_priority_enable_;     /**< 启用所有优先级设置的标志 */
   bool all_cpu_affinity_enable_; /**< 启用所有CPU亲和性设置的标志 */
+  bool deadline_active_;         /**< 线程当前是否处于`SCHED_DEADLINE`调度 */
+
+  MonitorTaskSlot* monitor_slot_;                  /**< 导出到共享内存的任务监控槽位，监控不可用时为`nullptr` */
+  std::unique_ptr<LatencyHistogram[]> local_hist_; /**< 监控不可用时使用的本地直方图 */
+  LatencyHistogram* wake_latency_hist_;            /**< 唤醒延迟直方图，位于监控槽位或本地 */
+  LatencyHistogram* run_time_hist_;                /**< 运行耗时直方图，位于监控槽位或本地 */
 
   std::shared_ptr<spdlog::logger> logger_; /**< 任务日志记录的记录器 */
 };
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/struct_type.hpp"
+
+namespace ocm {
+
+/**
+ * @class TaskGraph
+ * @brief 在任务线程与固定数量的辅助线程上并行运行一个任务周期内节点依赖图（DAG）的执行器。
+ *
+ * 每个周期由任务线程调用`Run`：重置各节点未完成的前驱数量，将没有前驱的节点放入就绪队列，唤醒辅助线程，
+ * 然后与辅助线程一起从就绪队列中取出节点运行；节点运行结束后，前驱全部完成的后继节点进入就绪队列。
+ * 所有节点运行结束后`Run`返回，构成周期屏障。
+ *
+ * 就绪队列是长度为节点数量的数组：每个周期恰好有节点数量次入队，取节点的线程先领取一个递增的序号，
+ * 再等待该序号对应的位置被填入，因此无需加锁。等待时先自旋，超过一定次数后在futex上睡眠。
+ */
+class TaskGraph {
+ public:
+  /**
+   * @brief 构造一个`TaskGraph`实例并创建辅助线程。
+   *
+   * 辅助线程数量为`cpu_affinity`中除第一个核心外的核心数量（不超过节点数量减一），第`i`个辅助线程绑定到`cpu_affinity[i + 1]`；
+   * 未启用CPU亲和性或只有一个核心时不创建辅助线程，节点按拓扑顺序在任务线程中依次运行。
+   *
+   * @param name 任务名称，用于命名辅助线程。
+   * @param depend 每个节点依赖的节点下标。
+   * @param run_node 运行单个节点的函数，参数为节点下标。
+   * @param system_setting 任务的系统设置，辅助线程使用其优先级与CPU亲和性。
+   * @param priority_enable 是否为辅助线程设置优先级。
+   * @param cpu_affinity_enable 是否为辅助线程设置CPU亲和性。
+   *
+   * @throws std::runtime_error 如果依赖关系中存在环或下标越界。
+   */
+  TaskGraph(const std::string& name, const std::vector<std::vector<size_t>>& depend, std::function<void(size_t)> run_node,
+            const SystemSetting& system_setting, bool priority_enable, bool cpu_affinity_enable);
+
+  /**
+   * @brief 析构函数，停止并回收辅助线程。
+   */
+  ~TaskGraph();
+
+  // 删除拷贝构造函数和赋值运算符
+  TaskGraph(const TaskGraph&) = delete;
+  TaskGraph& operator=(const TaskGraph&) = delete;
+
+  /**
+   * @brief 运行一个周期，所有节点运行结束后返回。
+   *
+   * 只能由任务线程调用。
+   */
+  void Run();
+
+  /**
+   * @brief 获取辅助线程数量。
+   *
+   * @return 辅助线程数量。
+   */
+  size_t GetHelperNum() const;
+
+ private:
+  /**
+   * @brief 辅助线程主循环，等待新的周期并参与运行节点。
+   */
+  void HelperLoop();
+
+  /**
+   * @brief 从就绪队列中领取并运行节点，直到本周期所有节点都已被领取。
+   */
+  void Work();
+
+  /**
+   * @brief 将节点放入就绪队列。
+   *
+   * @param node 节点下标。
+   */
+  void Push(size_t node);
+
+  /**
+   * @brief 等待就绪队列中的指定位置被填入。
+   *
+   * @param ticket 就绪队列位置。
+   * @return 节点下标。
+   */
+  size_t WaitSlot(size_t ticket);
+
+  std::string name_;                            /**< 任务名称 */
+  size_t node_num_;                             /**< 节点数量 */
+  std::function<void(size_t)> run_node_;        /**< 运行单个节点的函数 */
+  std::vector<std::vector<size_t>> successor_;  /**< 每个节点的后继节点下标 */
+  std::vector<int> indegree_;                   /**< 每个节点的前驱数量 */
+  std::vector<size_t> root_;                    /**< 没有前驱的节点下标 */
+  std::unique_ptr<std::atomic<int>[]> pending_; /**< 本周期每个节点尚未完成的前驱数量 */
+  std::unique_ptr<std::atomic<int>[]> slot_;    /**< 就绪队列，-1表示尚未填入 */
+  std::atomic<uint32_t> head_;                  /**< 下一个领取的就绪队列位置 */
+  std::atomic<uint32_t> tail_;                  /**< 下一个填入的就绪队列位置 */
+  std::atomic<uint32_t> push_seq_;              /**< 入队序号，同时作为等待就绪队列的futex字 */
+  std::atomic<uint32_t> push_waiters_;          /**< 等待就绪队列的线程数量 */
+  std::atomic<uint32_t> done_;                  /**< 本周期已完成的节点数量，同时作为任务线程等待周期结束的futex字 */
+  std::atomic<uint32_t> cycle_;                 /**< 周期序号，同时作为辅助线程等待新周期的futex字 */
+  std::atomic_bool alive_;                      /**< 辅助线程是否存活 */
+  std::vector<std::thread> helper_;             /**< 辅助线程 */
+};
+
+}  // namespace ocm
@@ -2,6 +2,11 @@
 
 #include <stdint.h>
 #include <time.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include "common/enum.hpp"
+#include "common/histogram.hpp"
 
 /*!
  * @file timer.hpp
@@ -10,12 +15,19 @@
 
 namespace ocm {
 
+/**
+ * @brief 错过截止时间时的回调函数类型。
+ *
+ * 参数为检测到错过时已经过去的释放时刻数量（至少为1）。回调在任务线程中同步调用，应尽量简短。
+ */
+using DeadlineMissCallback = std::function<void(uint64_t missed_periods)>;
+
 /**
  * @class TimerOnce
  * @brief 使用CLOCK_MONOTONIC时钟测量经过的时间。
  *
  * `TimerOnce`类提供了以毫秒、纳秒和秒为单位测量时间间隔的功能。
- * 它还允许以毫秒为单位获取当前时间。
+ * 它还允许以毫秒为单位获取当前时间。进程内启用仿真时间（`SimClock`）后，所有测量均改为读取仿真时间。
  */
 class TimerOnce {
  public:
@@ -87,10 +99,27 @@ class TimerLoop {
    *
    * @param period 循环的周期（秒）。
    *
-   * 该方法计算以毫秒和纳秒为单位的周期，重置内部时钟，并安排第一次唤醒时间。
+   * 该方法计算以毫秒和纳秒为单位的周期，并将第一次唤醒时间对齐到当前时间之后最近的相位网格点。
    */
   void SetPeriod(double period);
 
+  /**
+   * @brief 设置周期内的相位偏移。
+   *
+   * 唤醒时间满足`(t - phase) % period == 0`（`CLOCK_MONOTONIC`纳秒），因此同周期、不同相位的循环会被错开唤醒。
+   * 可在循环运行时从其它线程调用，下一次睡眠时重新对齐。
+   *
+   * @param phase 相位偏移（秒），按周期取模。
+   */
+  void SetPhase(double phase);
+
+  /**
+   * @brief 获取周期内的相位偏移。
+   *
+   * @return 相位偏移（秒）。
+   */
+  double GetPhase() const;
+
   /**
    * @brief 获取当前循环周期。
    *
@@ -105,13 +134,93 @@ class TimerLoop {
    */
   void SleepUntilNextLoop();
 
+  /**
+   * @brief 重新开始计时，下一次唤醒在当前时间之后最近的相位网格点。
+   */
+  void Restart();
+
+  /**
+   * @brief 设置错过截止时间后的处理策略。
+   *
+   * @param policy 超限策略，默认为`OverrunPolicy::CATCH_UP`。
+   */
+  void SetOverrunPolicy(OverrunPolicy policy);
+
+  /**
+   * @brief 设置错过截止时间时的回调函数。
+   *
+   * @param callback 回调函数，在`SleepUntilNextLoop`检测到错过时调用。
+   */
+  void SetMissCallback(DeadlineMissCallback callback);
+
+  /**
+   * @brief 获取错过截止时间的次数。
+   *
+   * @return 运行结束时已超过下一次唤醒时间的次数。
+   */
+  uint64_t GetMissCount() const;
+
+  /**
+   * @brief 获取最近一次唤醒对应的计划释放时间。
+   *
+   * @return 计划释放时间，`CLOCK_MONOTONIC`纳秒。
+   */
+  int64_t GetReleaseNs() const;
+
+  /**
+   * @brief 启用或关闭先睡眠后自旋的等待方式。
+   *
+   * 启用后先用`clock_nanosleep`睡眠到截止时间前的自旋余量处，再以`pause`指令自旋读取`CLOCK_MONOTONIC`直到截止时间，
+   * 以占用CPU为代价消除`clock_nanosleep`的唤醒延迟。
+   *
+   * @param enable 是否启用。
+   */
+  void SetHybridSpin(bool enable);
+
+  /**
+   * @brief 设置自旋余量。
+   *
+   * 自动校准时以该值为初始余量，每次睡眠后记录实际的唤醒延迟：唤醒晚于余量时立即放大余量，
+   * 并每累积一个窗口的样本按唤醒延迟的p99.9重新计算余量。余量不超过半个周期，以保证始终有睡眠样本可供校准。
+   *
+   * @param margin 自旋余量，以秒为单位。
+   * @param auto_calibrate 是否根据观测到的唤醒延迟自动校准。
+   */
+  void SetSpinMargin(double margin, bool auto_calibrate = true);
+
+  /**
+   * @brief 获取当前的自旋余量。
+   *
+   * @return 自旋余量，以秒为单位。
+   */
+  double GetSpinMargin() const;
+
  private:
   /**
-   * @brief 将循环周期添加到当前唤醒时间，处理纳秒溢出。
+   * @brief 将唤醒绝对时间对齐到当前时间之后最近的相位网格点。
+   */
+  void AlignToPhase();
+
+  /**
+   * @brief 睡眠直到唤醒绝对时间，启用自旋时在余量内自旋等待。
+   */
+  void WaitUntilWakeTime();
+
+  /**
+   * @brief 根据一次睡眠的唤醒延迟校准自旋余量。
+   *
+   * @param latency_ns 实际唤醒时间减去请求唤醒时间，以纳秒为单位。
+   */
+  void CalibrateSpinMargin(int64_t latency_ns);
+
+  /**
+   * @brief 将若干个循环周期添加到当前唤醒时间，处理纳秒溢出。
    *
    * 通过添加循环周期更新唤醒绝对时间，确保纳秒不超过十亿（每秒的纳秒数）。
+   *
+   * @param count 添加的周期数量。
    */
-  void AddPeriod();
+  void AddPeriod(uint64_t count = 1);
 
   timespec wake_abs_time_; /**< 下一个循环迭代的绝对唤醒时间 */
   /**< 下一个循环迭代的绝对唤醒时间 */
@@ -123,12 +232,26 @@ class TimerLoop {
   /**< 循环周期，以毫秒为单位 */
   long period_ns_; /**< 循环周期，以纳秒为单位 */
   /**< 循环周期，以纳秒为单位 */
+  std::atomic<int64_t> phase_ns_{0};                          /**< 相位偏移，以纳秒为单位 */
+  std::atomic_bool phase_changed_{false};                     /**< 相位是否在运行中被修改，需在下一次睡眠时重新对齐 */
+  OverrunPolicy overrun_policy_ = OverrunPolicy::CATCH_UP;    /**< 错过截止时间后的处理策略 */
+  DeadlineMissCallback miss_callback_;                        /**< 错过截止时间时的回调函数 */
+  std::atomic<uint64_t> miss_count_{0};                       /**< 错过截止时间的次数 */
+  int64_t release_ns_ = 0;                                    /**< 最近一次唤醒对应的计划释放时间 */
+  int64_t miss_reported_ns_ = 0;                              /**< 已作为错过截止时间上报的最晚计划释放时间 */
+  bool hybrid_spin_ = false;                                  /**< 是否先睡眠后自旋 */
+  bool auto_calibrate_ = true;                                /**< 是否自动校准自旋余量 */
+  std::atomic<int64_t> spin_margin_ns_{kDefaultSpinMarginNs}; /**< 自旋余量，以纳秒为单位 */
+  std::unique_ptr<LatencyHistogram> sleep_latency_;           /**< 当前校准窗口内的睡眠唤醒延迟，启用自旋时分配 */
 
   // Constants for nanosecond calculations
   static constexpr long NS_CARRY = 999999999; /**< 纳秒进位阈值 */
   /**< 纳秒进位阈值 */
   static constexpr long NS_TO_S = 1000000000; /**< 一秒中的纳秒数 */
   /**< 一秒中的纳秒数 */
+  static constexpr int64_t kDefaultSpinMarginNs = 50000; /**< 默认自旋余量（纳秒） */
+  static constexpr int64_t kMinSpinMarginNs = 2000;      /**< 自动校准的最小自旋余量（纳秒） */
+  static constexpr uint64_t kCalibrateWindow = 1024;     /**< 每次重新计算余量所需的样本数量 */
 };
 
 }  // namespace ocm
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "common/struct_type.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+
+namespace ocm {
+
+/**
+ * @brief 定时器服务中的一个周期性定时器。
+ *
+ * 每次到期时定时器服务递增`seq`并通过futex唤醒等待者，等待者比较`seq`即可判断是否到期，
+ * 因此即使唤醒发生在等待之前也不会丢失。
+ */
+struct TimerServiceEntry {
+  std::atomic<uint32_t> seq{0};        /**< 到期序号，同时作为futex字 */
+  std::atomic<int64_t> release_ns{0};  /**< 最近一次到期的计划节拍时间，`CLOCK_MONOTONIC`纳秒 */
+  uint64_t period_ticks = 1;           /**< 周期，以节拍为单位 */
+  uint64_t phase_ticks = 0;            /**< 相位偏移，以节拍为单位 */
+  uint64_t expires = 0;                /**< 下一次到期的节拍 */
+  TimerServiceEntry** pprev = nullptr; /**< 指向链表中指向本项的指针 */
+  TimerServiceEntry* next = nullptr;   /**< 时间轮槽位链表的后一项 */
+  bool active = false;                 /**< 是否已加入时间轮 */
+};
+
+/**
+ * @class TimerService
+ * @brief 由单个时钟线程驱动进程内所有周期任务的分层时间轮定时器服务。
+ *
+ * 时钟线程以固定节拍使用`clock_nanosleep`绝对睡眠，每个节拍只处理当前槽位中到期的定时器，
+ * 并通过futex直接唤醒对应任务，每节拍的开销与定时器总数无关。
+ * 节拍对齐到`CLOCK_MONOTONIC`的绝对网格，定时器的到期节拍满足`(tick - phase) % period == 0`，
+ * 因此同周期、不同相位的任务会被错开唤醒，且与内部定时器的相位原点一致。
+ *
+ * 时间轮共4层，分别为256、64、64、64个槽位，在1毫秒节拍下可覆盖约18小时的周期。
+ */
+class TimerService {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  TimerService(const TimerService&) = delete;
+  TimerService& operator=(const TimerService&) = delete;
+
+  /**
+   * @brief 获取TimerService的单例实例。
+   * @return 单例实例的引用。
+   */
+  static TimerService& getInstance();
+
+  /**
+   * @brief 配置节拍周期与时钟线程的系统设置。
+   *
+   * 必须在第一个定时器加入之前调用，时钟线程启动后调用将被忽略。
+   *
+   * @param tick 节拍周期，以秒为单位，默认0.001。
+   * @param system_setting 时钟线程的优先级与CPU亲和性，优先级为0时不修改。
+   */
+  void Configure(double tick, const SystemSetting& system_setting);
+
+  /**
+   * @brief 获取节拍周期。
+   *
+   * @return 节拍周期，以秒为单位。
+   */
+  double GetTick() const;
+
+  /**
+   * @brief 将定时器加入时间轮，必要时启动时钟线程。
+   *
+   * 若定时器已在时间轮中，则按新的周期与相位重新调度。
+   *
+   * @param entry 定时器，调用者负责其生命周期，需在销毁前调用`Remove`。
+   * @param period 周期，以秒为单位，按节拍四舍五入且至少为1个节拍，不是节拍的整数倍时记录警告。
+   * @param phase 相位偏移，以秒为单位，按节拍四舍五入，不是节拍的整数倍时记录警告。
+   */
+  void Add(TimerServiceEntry* entry, double period, double phase);
+
+  /**
+   * @brief 以当前节拍为起点重新计时，定时器在一个周期之后到期。
+   *
+   * 相位随之改为当前节拍对周期取余，再次调用`Add`时恢复为指定的相位。
+   *
+   * @param entry 已加入时间轮的定时器。
+   */
+  void Restart(TimerServiceEntry* entry);
+
+  /**
+   * @brief 将定时器移出时间轮。
+   *
+   * @param entry 定时器。
+   */
+  void Remove(TimerServiceEntry* entry);
+
+ private:
+  /**
+   * @brief 私有构造函数。
+   */
+  TimerService();
+
+  /**
+   * @brief 析构函数，停止时钟线程。
+   */
+  ~TimerService();
+
+  /**
+   * @brief 时钟线程主循环。
+   */
+  void Loop();
+
+  /**
+   * @brief 推进一个节拍，级联上层槽位并唤醒到期的定时器。
+   */
+  void Advance();
+
+  /**
+   * @brief 按到期节拍将定时器放入对应层级的槽位。
+   */
+  void Insert(TimerServiceEntry* entry);
+
+  /**
+   * @brief 将定时器从所在槽位中摘除。
+   */
+  void Unlink(TimerServiceEntry* entry);
+
+  /**
+   * @brief 将上层槽位中的定时器重新放入下层。
+   *
+   * @param level 层级。
+   * @param index 槽位下标。
+   * @return 槽位下标是否回绕为0，回绕时需要继续级联更上一层。
+   */
+  bool Cascade(int level, uint64_t index);
+
+  /**
+   * @brief 计算严格晚于当前节拍的下一个到期节拍。
+   */
+  uint64_t NextExpires(const TimerServiceEntry* entry) const;
+
+  static constexpr int kLevelNum = 4;                                           /**< 时间轮层数 */
+  static constexpr int kLevel0Bits = 8;                                         /**< 第0层槽位数的位数 */
+  static constexpr int kLevelBits = 6;                                          /**< 上层槽位数的位数 */
+  static constexpr uint64_t kLevel0Size = 1ULL << kLevel0Bits;                  /**< 第0层槽位数 */
+  static constexpr uint64_t kLevelSize = 1ULL << kLevelBits;                    /**< 上层槽位数 */
+  static constexpr uint64_t kMaxDelta = 1ULL << (kLevel0Bits + 3 * kLevelBits); /**< 时间轮可表示的最大节拍差 */
+
+  TimerServiceEntry* wheel0_[kLevel0Size];              /**< 第0层槽位 */
+  TimerServiceEntry* wheel_[kLevelNum - 1][kLevelSize]; /**< 第1至3层槽位 */
+  uint64_t current_tick_;                               /**< 当前节拍，第`n`个节拍的时间为`n * tick_ns_`（`CLOCK_MONOTONIC`纳秒） */
+  long tick_ns_;                                        /**< 节拍周期，以纳秒为单位 */
+  SystemSetting system_setting_;                        /**< 时钟线程的系统设置 */
+  std::mutex mutex_;                                    /**< 保护时间轮的互斥锁 */
+  std::thread thread_;                                  /**< 时钟线程 */
+  std::atomic_bool running_;                            /**< 时钟线程是否运行 */
+  std::shared_ptr<spdlog::logger> logger_;              /**< 日志记录器 */
+};
+
+}  // namespace ocm
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/struct_type.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+#include "task/timer.hpp"
+
+namespace ocm {
+
+/**
+ * @brief 工作线程池中的一个周期作业。
+ *
+ * 作业的释放时刻满足`(t - phase) % period == 0`（`CLOCK_MONOTONIC`纳秒），截止时间为下一次释放时刻。
+ * 除原子变量外，所有字段均由`WorkerPool`在其互斥锁保护下读写。
+ */
+struct WorkerPoolJob {
+  std::function<void()> run;                              /**< 作业的一次运行，在工作线程中调用 */
+  int64_t period_ns = 10000000;                           /**< 周期，以纳秒为单位 */
+  int64_t phase_ns = 0;                                   /**< 相位偏移，以纳秒为单位 */
+  int64_t start_delay_ns = 0;                             /**< 激活后到第一次释放的最短延迟，以纳秒为单位 */
+  int64_t next_release_ns = 0;                            /**< 下一次释放时刻 */
+  std::atomic<int64_t> release_ns{0};                     /**< 正在运行或最近一次运行对应的释放时刻 */
+  OverrunPolicy overrun_policy = OverrunPolicy::CATCH_UP; /**< 错过截止时间后的处理策略 */
+  DeadlineMissCallback miss_callback;                     /**< 错过截止时间时的回调函数 */
+  std::atomic<uint64_t> miss_count{0};                    /**< 错过截止时间的次数 */
+  int64_t miss_reported_ns = 0;                           /**< 已作为错过截止时间上报的最晚释放时刻 */
+  std::thread::id runner;                                 /**< 正在运行作业的工作线程 */
+  bool active = false;                                    /**< 是否参与调度 */
+  bool running = false;                                   /**< 是否正在某个工作线程中运行 */
+};
+
+/**
+ * @class WorkerPool
+ * @brief 以最早截止时间优先（EDF）顺序运行非实时周期任务的进程内工作线程池。
+ *
+ * 非实时任务不再各自独占线程，而是作为作业登记到线程池中，由少量工作线程在到期后按截止时间从早到晚取出运行，
+ * 从而减少线程数量、线程栈与上下文切换。同一作业不会被并行运行；作业运行结束时已到达下一次释放时刻即判定为错过截止时间。
+ * 作业数量通常为几十个，每次调度线性扫描全部作业即可。
+ */
+class WorkerPool {
+ public:
+  // 删除拷贝构造函数和赋值运算符
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief 获取WorkerPool的单例实例。
+   * @return 单例实例的引用。
+   */
+  static WorkerPool& getInstance();
+
+  /**
+   * @brief 配置工作线程数量与系统设置。
+   *
+   * 必须在第一个作业登记之前调用，工作线程启动后调用将被忽略。
+   *
+   * @param worker_num 工作线程数量，至少为1，默认2。
+   * @param system_setting 工作线程的优先级与CPU亲和性，优先级为0时不修改。
+   */
+  void Configure(int worker_num, const SystemSetting& system_setting);
+
+  /**
+   * @brief 登记作业，必要时启动工作线程。
+   *
+   * @param job 作业，调用者负责其生命周期，需在销毁前调用`Remove`。
+   */
+  void Add(WorkerPoolJob* job);
+
+  /**
+   * @brief 注销作业，作业正在运行时等待其结束。
+   *
+   * @param job 作业。
+   */
+  void Remove(WorkerPoolJob* job);
+
+  /**
+   * @brief 设置作业的周期与相位，作业已激活时重新对齐下一次释放时刻。
+   *
+   * @param job 作业。
+   * @param period 周期，以秒为单位。
+   * @param phase 相位偏移，以秒为单位。
+   */
+  void SetTiming(WorkerPoolJob* job, double period, double phase);
+
+  /**
+   * @brief 激活作业，第一次释放在启动延迟之后最近的相位网格点。
+   *
+   * @param job 作业。
+   */
+  void Activate(WorkerPoolJob* job);
+
+  /**
+   * @brief 停止调度作业，作业正在其它线程中运行时等待其结束。
+   *
+   * @param job 作业。
+   */
+  void Deactivate(WorkerPoolJob* job);
+
+ private:
+  /**
+   * @brief 私有构造函数。
+   */
+  WorkerPool();
+
+  /**
+   * @brief 析构函数，停止工作线程。
+   */
+  ~WorkerPool();
+
+  /**
+   * @brief 工作线程主循环。
+   *
+   * @param index 工作线程序号。
+   */
+  void Loop(int index);
+
+  /**
+   * @brief 作业运行结束后按超限策略安排下一次释放时刻。
+   *
+   * @param job 作业。
+   * @param now_ns 当前时间，`CLOCK_MONOTONIC`纳秒。
+   * @return 新错过且尚未上报过的释放时刻数量，未错过截止时间或追赶运行时的释放都已上报时为0。
+   */
+  uint64_t ScheduleNext(WorkerPoolJob* job, int64_t now_ns);
+
+  /**
+   * @brief 计算不早于`from_ns`的最近相位网格点。
+   */
+  static int64_t NextAligned(const WorkerPoolJob* job, int64_t from_ns);
+
+  std::vector<WorkerPoolJob*> jobs_;       /**< 已登记的作业 */
+  std::vector<std::thread> threads_;       /**< 工作线程 */
+  int worker_num_;                         /**< 工作线程数量 */
+  SystemSetting system_setting_;           /**< 工作线程的系统设置 */
+  std::mutex mutex_;                       /**< 保护作业状态的互斥锁 */
+  std::condition_variable ready_cv_;       /**< 工作线程等待作业释放的条件变量 */
+  std::condition_variable idle_cv_;        /**< 等待作业运行结束的条件变量 */
+  std::atomic_bool running_;               /**< 工作线程是否运行 */
+  std::shared_ptr<spdlog::logger> logger_; /**< 日志记录器 */
+};
+
+}  // namespace ocm
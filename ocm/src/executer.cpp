@@ -1,16 +1,67 @@
 #include "executer/executer.hpp"
 
 #include <algorithm>
-#include <chrono>
-#include <thread>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unistd.h>
+#include "common/state_notifier.hpp"
 #include "common/struct_type.hpp"
 #include "executer/desired_group_data.hpp"
+#include "monitor/trace.hpp"
+#include "ocm/topic_signal.hpp"
+#include "task/rt/sched_rt.hpp"
+#include "task/timer_service.hpp"
+#include "task/worker_pool.hpp"
 
 namespace ocm {
 
+namespace {
+
+/**
+ * @brief 选择执行器的睡眠机制。
+ *
+ * 时间驱动的执行器改为等待期望组话题的发布通知，并在执行器周期与相位的绝对网格点超时唤醒以完成周期性工作；
+ * 外部时钟、触发与仿真驱动的执行器以及话题通知共享内存段不可用时保持配置的定时器类型。
+ */
+TimerType SelectExecuterTimerType(const TimerSetting& timer_setting) {
+  TimerType type = timer_setting.timer_type;
+  bool time_driven = type == TimerType::INTERNAL_TIMER || type == TimerType::TIMER_SERVICE || type == TimerType::HYBRID_SPIN ||
+                     type == TimerType::TOPIC_TRIGGER;
+  if (time_driven && TopicSignal::getInstance().GetSegment()) {
+    return TimerType::TOPIC_TRIGGER;
+  }
+  return type;
+}
+
+/**
+ * @brief 按执行器设置配置进程内的时间轮定时器服务。
+ *
+ * 时钟线程在第一个定时器加入时启动，此后配置不再生效，因此需在构造执行器自身的睡眠机制之前调用。
+ *
+ * @return 传入的执行器设置，便于在构造函数的初始化列表中使用。
+ */
+const ExecuterSetting& ConfigureTimerService(const ExecuterSetting& executer_setting) {
+  SystemSetting clock_system_setting;
+  clock_system_setting.priority = executer_setting.all_priority_enable ? executer_setting.timer_service_priority : 0;
+  TimerService::getInstance().Configure(executer_setting.timer_service_tick, clock_system_setting);
+  return executer_setting;
+}
+
+}  // namespace
+
 Executer::Executer(const ExecuterConfig& executer_config, const std::shared_ptr<NodeMap>& node_map, const std::string& desired_group_topic_name)
-    : TaskBase(executer_config.executer_setting.package_name, executer_config.executer_setting.timer_setting.timer_type, 0.0,
-               executer_config.executer_setting.all_priority_enable, executer_config.executer_setting.all_cpu_affinity_enable),
+    : TaskBase(executer_config.executer_setting.package_name,
+               SelectExecuterTimerType(ConfigureTimerService(executer_config.executer_setting).timer_setting), 0.0,
+               executer_config.executer_setting.all_priority_enable, executer_config.executer_setting.all_cpu_affinity_enable,
+               executer_config.executer_setting.timer_setting.clock_name),
+      current_group_index_(0),
+      target_group_index_(0),
+      desired_group_index_(0),
+      transition_(nullptr),
+      transition_trace_start_(0),
+      prewarm_stop_(false),
       node_map_(node_map),
       executer_config_(executer_config),
       desired_group_("empty_init"),
@@ -23,14 +74,41 @@ Executer::Executer(const ExecuterConfig& executer_config, const std::shared_ptr<
       task_stop_flag_(true),
       task_start_flag_(true),
       all_current_task_stop_(false),
-      desired_group_topic_name_(desired_group_topic_name) {
-  logger_ = GetLogger();                                                // 获取日志记录器
-  desired_group_topic_lcm_ = std::make_shared<SharedMemoryTopicLcm>();  // 创建共享内存主题
-  SetPeriod(executer_config_.executer_setting.timer_setting.period);    // 设置周期
-  TaskStart(executer_config_.executer_setting.system_setting);          // 启动任务
+      all_release_task_stop_(false),
+      desired_group_topic_name_(desired_group_topic_name),
+      phase_assign_time_(-1.0) {
+  transition_plan_ready_.store(false);
+  logger_ = GetLogger();                                                             // 获取日志记录器
+  desired_group_topic_lcm_ = std::make_shared<SharedMemoryTopicLcm>();               // 创建共享内存主题
+  SetPeriod(executer_config_.executer_setting.timer_setting.period);                 // 设置周期
+  SetPhase(executer_config_.executer_setting.timer_setting.phase);                   // 设置相位偏移
+  SetOverrunPolicy(executer_config_.executer_setting.timer_setting.overrun_policy);  // 设置超限策略
+  const auto& timer_setting = executer_config_.executer_setting.timer_setting;
+  if (SelectExecuterTimerType(timer_setting) == TimerType::TOPIC_TRIGGER) {
+    // 期望组话题发布时立即唤醒，无发布时在周期网格点超时唤醒，超时不计为错过截止时间
+    std::vector<std::string> trigger_topics = timer_setting.trigger_topics;
+    trigger_topics.push_back(desired_group_topic_name_ + "_lcm");
+    SetTriggerTopics(trigger_topics, TriggerPolicy::ANY_OF, timer_setting.period, false, true);
+    logger_->info("[Executer] Executer wakes on desired group topic {} and every {} s at phase {} s.", desired_group_topic_name_ + "_lcm",
+                  timer_setting.period, timer_setting.phase);
+    if (timer_setting.timer_type == TimerType::HYBRID_SPIN || timer_setting.overrun_policy != OverrunPolicy::SKIP) {
+      // 话题触发的睡眠不自旋，错过的网格点直接跳过
+      logger_->warn("[Executer] Overrun policy and hybrid spin of the configured executer timer are ignored, missed periods are skipped.");
+    }
+  } else {
+    // 外部时钟、触发与仿真驱动的执行器只在自身的节拍运行，期望组最多延迟一个执行器周期才被处理
+    logger_->warn("[Executer] Timer type does not wake on desired group topic {}, group switches may be delayed by up to {} s.",
+                  desired_group_topic_name_ + "_lcm", timer_setting.period);
+  }
+  ConnectPort();                                                                     // 连接节点数据端口
+  TaskStart(executer_config_.executer_setting.system_setting);                       // 启动任务
 }
 
+Executer::~Executer() { StopPrewarm(); }
+
 void Executer::ExitAllTask() {
+  StopPrewarm();  // 先停止预热线程，再销毁任务
+
   // 停止所有常驻组任务
   for (auto& task : resident_group_task_list_) {
     task.second->TaskStop(executer_config_.executer_setting.idle_system_setting);  // 停止任务
@@ -42,18 +120,26 @@ void Executer::ExitAllTask() {
     task.second->TaskStop(executer_config_.executer_setting.idle_system_setting);  // 停止任务
     task.second->TaskDestroy();                                                    // 销毁任务
   }
-
-  std::this_thread::sleep_for(std::chrono::seconds(1));  // 等待1秒
 }
 
 void Executer::CreateTask() {
+  ResolveNodeId();  // 将配置中的节点名称解析为节点ID
+
+  // 配置运行非实时任务的工作线程池，工作线程使用普通调度，并与预热线程一样绑定到空闲设置的核心
+  SystemSetting worker_system_setting;
+  worker_system_setting.priority = 0;
+  if (executer_config_.executer_setting.all_cpu_affinity_enable) {
+    worker_system_setting.cpu_affinity = executer_config_.executer_setting.idle_system_setting.cpu_affinity;
+  }
+  WorkerPool::getInstance().Configure(executer_config_.executer_setting.worker_num, worker_system_setting);
+
   // 创建常驻组任务
   for (auto& task_setting : executer_config_.task_list.resident_group) {
     std::shared_ptr<std::vector<std::shared_ptr<NodeBase>>> node_list = std::make_shared<std::vector<std::shared_ptr<NodeBase>>>();
 
     // 获取节点列表
     for (auto& node_config : task_setting.second.node_list) {
-      node_list->emplace_back(node_map_->GetNodePtr(node_config.node_name));  // 添加节点指针
+      node_list->emplace_back(node_map_->GetNodePtr(node_config.node_id));  // 添加节点指针
     }
 
     // 创建任务并添加到常驻组任务列表
@@ -70,7 +156,7 @@ void Executer::CreateTask() {
 
     // 获取节点列表
     for (auto& node_config : task_setting.second.node_list) {
-      node_list->emplace_back(node_map_->GetNodePtr(node_config.node_name));  // 添加节点指针
+      node_list->emplace_back(node_map_->GetNodePtr(node_config.node_id));  // 添加节点指针
     }
 
     // 创建任务并添加到待命组任务列表
@@ -81,11 +167,166 @@ void Executer::CreateTask() {
     logger_->info("[Executer] Task {} added.", task_setting.second.task_name);  // 记录任务添加信息
   }
 
-  // 添加独占任务组
+  BuildTransitionPlan();  // 预计算独占任务组之间的切换计划
+
+  if (executer_config_.executer_setting.prewarm_enable) {
+    for (size_t i = 0; i < group_node_.size(); ++i) {
+      PrewarmGroup(group_name_[i]);  // 在后台预热所有排他性任务组
+    }
+  }
+}
+
+void Executer::ResolveNodeId() {
+  auto resolve = [this](const std::vector<std::string>& node_name_list, std::vector<NodeId>& node_id_list) {
+    node_id_list.clear();
+    for (const auto& node_name : node_name_list) {
+      node_id_list.push_back(node_map_->GetNodeId(node_name));
+    }
+  };
+  auto resolve_task = [this, &resolve](TaskSetting& task_setting) {
+    for (auto& node_config : task_setting.node_list) {
+      node_config.node_id = node_map_->GetNodeId(node_config.node_name);
+    }
+    resolve(task_setting.launch_setting.pre_node, task_setting.launch_setting.pre_node_id);
+  };
+  for (auto& task_setting : executer_config_.task_list.resident_group) {
+    resolve_task(task_setting.second);
+  }
+  for (auto& task_setting : executer_config_.task_list.standby_group) {
+    resolve_task(task_setting.second);
+  }
   for (auto& exclusive_task_group : executer_config_.exclusive_task_group) {
-    logger_->info("[Executer] Exclusive group {} added.", exclusive_task_group.second.group_name);  // 记录独占组添加信息
-    exclusive_group_set_.insert(exclusive_task_group.second.group_name);                            // 添加到独占组集合
+    for (auto& task_config : exclusive_task_group.second.task_list) {
+      resolve(task_config.second.force_init_node, task_config.second.force_init_node_id);
+      resolve(task_config.second.pre_node, task_config.second.pre_node_id);
+    }
+  }
+}
+
+void Executer::BuildTransitionPlan() {
+  const auto& exclusive_group_config = executer_config_.exclusive_task_group;
+  for (auto& exclusive_task_group : exclusive_group_config) {
+    group_name_.push_back(exclusive_task_group.second.group_name);
+  }
+  std::sort(group_name_.begin(), group_name_.end());
+  size_t group_num = group_name_.size();
+  for (size_t i = 0; i < group_num; ++i) {
+    group_index_[group_name_[i]] = i;
+    logger_->info("[Executer] Exclusive group {} added.", group_name_[i]);  // 记录独占组添加信息
+  }
+  group_name_.push_back("empty_init");  // 启动时的空任务组，只作为切换的起点
+  current_group_index_ = group_num;
+  desired_group_index_ = group_num;
+
+  // 每个任务组包含的任务与节点
+  std::vector<std::vector<std::shared_ptr<Task>>> group_task(group_num + 1);
+  std::vector<std::vector<const GroupTaskSetting*>> group_task_setting(group_num + 1);
+  std::vector<std::set<NodeId>> group_node(group_num + 1);
+  for (size_t i = 0; i < group_num; ++i) {
+    for (auto& task_config : exclusive_group_config.at(group_name_[i]).task_list) {
+      const auto& task_name = task_config.second.task_name;
+      auto task_it = standby_group_task_list_.find(task_name);
+      if (task_it == standby_group_task_list_.end()) {
+        continue;
+      }
+      group_task[i].push_back(task_it->second);
+      group_task_setting[i].push_back(&task_config.second);
+      for (auto& node : task_it->second->GetTaskSetting().node_list) {
+        group_node[i].insert(node.node_id);
+      }
+    }
+  }
+  group_node_.resize(group_num);
+  for (size_t i = 0; i < group_num; ++i) {
+    for (NodeId node : group_node[i]) {
+      group_node_[i].push_back(node_map_->GetNodePtr(node).get());
+    }
+  }
+  // 日志中的节点名称按名称排序
+  auto join_node_name = [this](const std::set<NodeId>& node_set) {
+    std::set<std::string> node_name_set;
+    for (NodeId node : node_set) {
+      node_name_set.insert(node_map_->GetNodeName(node));
+    }
+    return JointStrSet(node_name_set, ",");
+  };
+
+  bool overlap = executer_config_.executer_setting.overlap_transition_enable;
+  transition_plan_.resize((group_num + 1) * group_num);
+  for (size_t from = 0; from <= group_num; ++from) {
+    for (size_t to = 0; to < group_num; ++to) {
+      TransitionPlan& plan = transition_plan_[from * group_num + to];
+      plan.trace_name = Trace::getInstance().Intern(group_name_[from] + "->" + group_name_[to]);  // 登记切换的跟踪事件名称
+
+      // 计算退出节点和进入节点
+      std::set<NodeId> exit_node_set, enter_node_set;
+      std::set_difference(group_node[from].begin(), group_node[from].end(), group_node[to].begin(), group_node[to].end(),
+                          std::inserter(exit_node_set, exit_node_set.begin()));
+      std::set_difference(group_node[to].begin(), group_node[to].end(), group_node[from].begin(), group_node[from].end(),
+                          std::inserter(enter_node_set, enter_node_set.begin()));
+      for (NodeId node : enter_node_set) {
+        plan.enter_node.push_back(node_map_->GetNodePtr(node).get());
+      }
+
+      // 目标任务的前置节点与初始化节点：强制初始化节点与进入节点的并集
+      std::set<NodeId> init_node_set, start_node_set;
+      for (size_t k = 0; k < group_task[to].size(); ++k) {
+        const auto& task = group_task[to][k];
+        const auto& task_setting = *group_task_setting[to][k];
+        TransitionTask start_task;
+        start_task.task = task;
+        for (NodeId pre_node : task_setting.pre_node_id) {
+          start_task.pre_node.push_back(node_map_->GetNodePtr(pre_node).get());
+        }
+        std::set<NodeId> force_init_node_set(task_setting.force_init_node_id.begin(), task_setting.force_init_node_id.end());
+        const auto& node_list = task->GetTaskSetting().node_list;
+        for (size_t i = 0; i < node_list.size(); ++i) {
+          NodeId node = node_list[i].node_id;
+          if (force_init_node_set.count(node) || enter_node_set.count(node)) {
+            start_task.init_node.push_back(i);
+            init_node_set.insert(node);
+          }
+        }
+        if (overlap && std::find(group_task[from].begin(), group_task[from].end(), task) != group_task[from].end()) {
+          plan.keep_task.push_back(std::move(start_task));  // 两个任务组共用的任务保持运行
+        } else {
+          for (const auto& node : node_list) {
+            start_node_set.insert(node.node_id);
+          }
+          plan.start_task.push_back(std::move(start_task));
+        }
+      }
+
+      // 与待启动任务共用节点的当前任务需先停止，其余当前任务在目标任务启动之后停止
+      std::set<NodeId> release_node_set;
+      for (const auto& task : group_task[from]) {
+        if (overlap && std::find(group_task[to].begin(), group_task[to].end(), task) != group_task[to].end()) {
+          continue;
+        }
+        const auto& node_list = task->GetTaskSetting().node_list;
+        bool conflict = !overlap || std::any_of(node_list.begin(), node_list.end(),
+                                                [&start_node_set](const NodeConfig& node) { return start_node_set.count(node.node_id) > 0; });
+        if (conflict) {
+          plan.stop_task.push_back(task);
+        } else {
+          plan.release_task.push_back(task);
+          for (const auto& node : node_list) {
+            release_node_set.insert(node.node_id);
+          }
+        }
+      }
+      for (NodeId node : exit_node_set) {
+        auto& exit_node = release_node_set.count(node) ? plan.release_exit_node : plan.exit_node;
+        exit_node.push_back(node_map_->GetNodePtr(node).get());
+      }
+
+      plan.exit_node_log = join_node_name(exit_node_set);
+      plan.enter_node_log = join_node_name(enter_node_set);
+      plan.init_node_log = join_node_name(init_node_set);
+      plan.running_node_log = join_node_name(group_node[to]);
+    }
   }
+  transition_plan_ready_.store(true, std::memory_order_release);  // 切换计划建立后才处理期望组
 }
 
 void Executer::InitTask() {
@@ -100,14 +341,15 @@ void Executer::InitTask() {
 
   // 等待所有任务启动
   while (!task_set_wait_to_start.empty()) {
+    uint32_t state_seq = StateNotifier::getInstance().GetSeq();  // 检查前置节点前读取状态变更序号
     for (auto& task : task_list_wait_to_start) {
       if (!task.first) {                                                                         // 如果任务尚未启动
-        bool is_pre_node_empty = task.second->GetTaskSetting().launch_setting.pre_node.empty();  // 检查前置节点是否为空
-        const auto& pre_node_list = task.second->GetTaskSetting().launch_setting.pre_node;       // 获取前置节点列表
+        const auto& pre_node_list = task.second->GetTaskSetting().launch_setting.pre_node_id;  // 获取前置节点ID列表
+        bool is_pre_node_empty = pre_node_list.empty();                                         // 检查前置节点是否为空
 
         // 检查前置节点是否准备就绪
-        bool is_pre_node_ready = std::all_of(pre_node_list.begin(), pre_node_list.end(), [this](const std::string& pre_node_name) {
-          return node_map_->GetNodePtr(pre_node_name)->GetState() == NodeState::RUNNING;  // 检查节点状态
+        bool is_pre_node_ready = std::all_of(pre_node_list.begin(), pre_node_list.end(), [this](NodeId pre_node) {
+          return node_map_->GetNodePtr(pre_node)->GetState() == NodeState::RUNNING;  // 检查节点状态
         });
 
         // 如果前置节点为空或准备就绪，启动任务
@@ -120,180 +362,346 @@ void Executer::InitTask() {
         }
       }
     }
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));  // 等待1毫秒
+    if (!task_set_wait_to_start.empty()) {
+      StateNotifier::getInstance().WaitChange(state_seq);  // 等待节点状态变化
+    }
+  }
+
+  if (executer_config_.executer_setting.auto_phase_enable) {
+    phase_assign_time_ = phase_assign_timer_.getNowTime() + kPhaseAssignDelayMs;  // 积累运行耗时样本后分配相位
   }
 }
 
 void Executer::Run() {
-  // 订阅期望组数据
-  desired_group_topic_lcm_->SubscribeNoWait<DesiredGroupData>(
-      desired_group_topic_name_ + "_lcm", desired_group_topic_name_ + "_lcm",
-      [this](const DesiredGroupData& desired_group) { desired_group_ = desired_group.desired_group; });  // 更新期望组
-  TransitionCheck();                                                                                     // 检查状态转换
+  if (transition_plan_ready_.load(std::memory_order_acquire)) {
+    // 期望组话题有新发布时才解码，组名换算为下标后，切换检查只比较整数下标
+    desired_group_topic_lcm_->SubscribeNoWait<DesiredGroupData>(
+        desired_group_topic_name_ + "_lcm", desired_group_topic_name_ + "_lcm",
+        [this](const DesiredGroupData& desired_group) { UpdateDesiredGroup(desired_group.desired_group); });  // 更新期望组
+    TransitionCheck();                                                                                        // 检查状态转换
+  }
 
   if (is_transition_) {
     Transition();  // 执行状态转换
   }
-}
-
-void Executer::TransitionCheck() {
-  if (!is_transition_) {                                    // 如果当前不在转换状态
-    const auto& desired_group = desired_group_.GetValue();  // 获取期望组
-    const auto& current_group = current_group_.GetValue();  // 获取当前组
-
-    if (desired_group != current_group) {                                            // 如果期望组与当前组不同
-      if (exclusive_group_set_.find(desired_group) != exclusive_group_set_.end()) {  // 检查期望组是否为独占组
-        target_task_set_.clear();                                                    // 清空目标任务集合
-        current_task_set_.clear();                                                   // 清空当前任务集合
-        target_node_set_.clear();                                                    // 清空目标节点集合
-        current_node_set_.clear();                                                   // 清空当前节点集合
-        enter_node_set_.clear();                                                     // 清空进入节点集合
-        exit_node_set_.clear();                                                      // 清空退出节点集合
-
-        const auto& exclusive_group_config = executer_config_.exclusive_task_group;  // 获取独占组配置
-        if (exclusive_group_config.find(desired_group) != executer_config_.exclusive_task_group.end()) {
-          for (auto& task_config : exclusive_group_config.at(desired_group).task_list) {
-            const auto& task_name = task_config.second.task_name;
-            if (standby_group_task_list_.find(task_name) != standby_group_task_list_.end()) {
-              target_task_set_.insert(standby_group_task_list_.at(task_name));  // 添加目标任务
-            }
-            if (executer_config_.task_list.standby_group.find(task_name) != executer_config_.task_list.standby_group.end()) {
-              for (auto& node : executer_config_.task_list.standby_group.at(task_name).node_list) {
-                target_node_set_.insert(node.node_name);  // 添加目标节点
-              }
-            }
-          }
-        }
 
-        if (current_group != "empty_init") {  // 如果当前组不为空初始化
-          if (exclusive_group_config.find(current_group) != exclusive_group_config.end()) {
-            for (auto& task_config : exclusive_group_config.at(current_group).task_list) {
-              const auto& task_name = task_config.second.task_name;  // 获取任务名称
-              if (standby_group_task_list_.find(task_name) != standby_group_task_list_.end()) {
-                current_task_set_.insert(standby_group_task_list_.at(task_name));  // 添加当前任务
-              }
-              if (executer_config_.task_list.standby_group.find(task_name) != executer_config_.task_list.standby_group.end()) {
-                for (auto& node : executer_config_.task_list.standby_group.at(task_name).node_list) {
-                  current_node_set_.insert(node.node_name);  // 添加当前节点
-                }
-              }
-            }
-          }
-        }
-
-        // 计算退出节点和进入节点
-        std::set_difference(current_node_set_.begin(), current_node_set_.end(), target_node_set_.begin(), target_node_set_.end(),
-                            std::inserter(exit_node_set_, exit_node_set_.begin()));  // 计算退出节点
-
-        std::set_difference(target_node_set_.begin(), target_node_set_.end(), current_node_set_.begin(), current_node_set_.end(),
-                            std::inserter(enter_node_set_, enter_node_set_.begin()));  // 计算进入节点
+  double phase_assign_time = phase_assign_time_.load();
+  if (phase_assign_time >= 0 && phase_assign_timer_.getNowTime() >= phase_assign_time) {
+    phase_assign_time_ = -1.0;
+    AssignPhase();  // 按实测运行耗时分配相位
+  }
+}
 
-        all_node_exit_check_ = false;    // 重置退出节点检查标志
-        all_node_enter_check_ = false;   // 重置进入节点检查标志
-        is_transition_ = true;           // 设置为转换状态
-        task_stop_flag_ = true;          // 设置任务停止标志
-        task_start_flag_ = true;         // 设置任务启动标志
-        all_current_task_stop_ = false;  // 重置当前任务停止标志
-        target_group_ = desired_group;   // 设置目标组
+void Executer::UpdateDesiredGroup(const std::string& desired_group) {
+  desired_group_ = desired_group;                    // 更新期望组
+  auto group_it = group_index_.find(desired_group);  // 查找期望组的下标
+  if (group_it != group_index_.end()) {              // 检查期望组是否为独占组
+    desired_group_index_ = group_it->second;         // 更新期望组下标
+  } else {
+    if (desired_group_history_ != desired_group) {  // 如果历史期望组与当前期望组不同
+      desired_group_history_ = desired_group;       // 更新历史期望组
+      logger_->error("[Executer] Target group {} is not an exclusive group.", ColorPrint(desired_group, ColorEnum::RED));  // 记录错误信息
+    }
+  }
+}
 
-        logger_->info("[Executer] Transition from group {} to group {}", ColorPrint(current_group, ColorEnum::YELLOW),
-                      ColorPrint(desired_group, ColorEnum::YELLOW));  // 记录转换信息
-      } else {
-        if (desired_group_history_ != desired_group) {  // 如果历史期望组与当前期望组不同
-          desired_group_history_ = desired_group;       // 更新历史期望组
-          logger_->error("[Executer] Target group {} is not an exclusive group.", ColorPrint(desired_group, ColorEnum::RED));  // 记录错误信息
+void Executer::TransitionCheck() {
+  if (!is_transition_) {                                 // 如果当前不在转换状态
+    if (desired_group_index_ != current_group_index_) {  // 如果期望组与当前组不同
+      target_group_index_ = desired_group_index_;
+      transition_ = &transition_plan_[current_group_index_ * group_index_.size() + target_group_index_];  // 取出预计算的切换计划
+      transition_trace_start_ = Trace::IsEnabled() ? Trace::Now() : 0;
+      for (const auto* node_list : {&transition_->exit_node, &transition_->release_exit_node, &transition_->enter_node}) {
+        for (auto* node : *node_list) {
+          node->ResetTransitionCheck();  // 清除上一次切换遗留的检查结果
         }
       }
+
+      all_node_exit_check_ = false;                      // 重置退出节点检查标志
+      all_node_enter_check_ = false;                     // 重置进入节点检查标志
+      is_transition_ = true;                             // 设置为转换状态
+      task_stop_flag_ = true;                            // 设置任务停止标志
+      task_start_flag_ = true;                           // 设置任务启动标志
+      all_current_task_stop_ = false;                    // 重置当前任务停止标志
+      all_release_task_stop_ = false;                    // 重置其余当前任务停止标志
+      target_group_ = group_name_[target_group_index_];  // 设置目标组
+
+      logger_->info("[Executer] Transition from group {} to group {}", ColorPrint(current_group_.GetValue(), ColorEnum::YELLOW),
+                    ColorPrint(target_group_, ColorEnum::YELLOW));  // 记录转换信息
     }
   }
 }
 
 void Executer::Transition() {
+  const auto& stop_task = transition_->stop_task;
+  const auto& release_task = transition_->release_task;
+  auto is_standby = [](const auto& task) { return task->GetState() == TaskState::STANDBY; };
+  if (!all_node_exit_check_ || !all_node_enter_check_) {
+    // 节点的异步检查通过时通过StateNotifier唤醒，在一个执行器周期内等待检查通过，通过后在本周期内立即继续切换
+    StateNotifier::getInstance().WaitFor([this] { return CheckTransitionNode(); }, executer_config_.executer_setting.timer_setting.period);
+  }
   if (all_node_exit_check_ && all_node_enter_check_) {  // 如果所有节点退出和进入检查通过
     if (task_stop_flag_) {                              // 如果任务停止标志为真
       task_stop_flag_ = false;                          // 重置任务停止标志
-      for (auto& task : current_task_set_) {
+      for (auto& task : stop_task) {
         task->TaskStop(executer_config_.executer_setting.idle_system_setting);  // 停止当前任务
       }
+      // 在一个执行器周期内等待当前任务进入待命，超时则在后续周期继续检查
+      all_current_task_stop_ = StateNotifier::getInstance().WaitFor(
+          [&stop_task, &is_standby] { return std::all_of(stop_task.begin(), stop_task.end(), is_standby); },
+          executer_config_.executer_setting.timer_setting.period);
     }
 
     if (all_current_task_stop_) {  // 如果所有当前任务已停止
-      for (auto& node : exit_node_set_) {
-        node_map_->GetNodePtr(node)->AfterExit();                   // 执行退出后操作
-        node_map_->GetNodePtr(node)->SetState(NodeState::STANDBY);  // 设置节点状态为待命
-      }
-      std::vector<std::pair<bool, std::shared_ptr<Task>>> task_list_wait_to_start;  // 等待启动的任务列表
-      std::set<std::string> task_set_wait_to_start;                                 // 等待启动的任务集合
-      for (auto& task_ptr : target_task_set_) {
-        task_list_wait_to_start.emplace_back(std::make_pair(false, task_ptr));  // 添加任务指针
-        task_set_wait_to_start.insert(task_ptr->GetTaskName());                 // 添加任务名称
-      }
-      std::set<std::string> all_init_node_set_log;  // 记录所有初始化节点集合
-
-      // 等待所有目标任务启动
-      while (!task_set_wait_to_start.empty()) {
-        for (auto& task : task_list_wait_to_start) {
-          const auto& task_name = task.second->GetTaskName();  // 获取任务名称
-          if (!task.first) {
-            GroupTaskSetting task_setting;
-            const auto& exclusive_task_group = executer_config_.exclusive_task_group;  // 获取独占组配置
-            if (exclusive_task_group.find(target_group_) != exclusive_task_group.end()) {
-              if (exclusive_task_group.at(target_group_).task_list.find(task_name) != exclusive_task_group.at(target_group_).task_list.end()) {
-                task_setting = exclusive_task_group.at(target_group_).task_list.at(task_name);  // 获取任务设置
-              }
-            }
-            bool is_pre_node_empty = task_setting.pre_node.empty();  // 检查前置节点是否为空
-            const auto& pre_node_list = task_setting.pre_node;       // 获取前置节点列表
-
-            // 获取强制初始化节点集合
-            std::set<std::string> force_init_node_set(task_setting.force_init_node.begin(), task_setting.force_init_node.end());
-            std::set<std::string> all_init_node_set;  // 所有初始化节点集合
-            std::set_union(force_init_node_set.begin(), force_init_node_set.end(), enter_node_set_.begin(), enter_node_set_.end(),
-                           std::inserter(all_init_node_set, all_init_node_set.begin()));  // 合并初始化节点集合
+      if (task_start_flag_) {      // 如果任务启动标志为真
+        task_start_flag_ = false;  // 重置任务启动标志
+        for (auto* node : transition_->exit_node) {
+          node->AfterExit();                   // 执行退出后操作
+          node->SetState(NodeState::STANDBY);  // 设置节点状态为待命
+        }
 
+        // 等待所有目标任务启动
+        const auto& start_task = transition_->start_task;
+        std::vector<bool> task_started(start_task.size(), false);  // 任务是否已启动
+        size_t task_num_wait_to_start = start_task.size();         // 等待启动的任务数量
+        while (task_num_wait_to_start > 0) {
+          uint32_t state_seq = StateNotifier::getInstance().GetSeq();  // 检查前置节点前读取状态变更序号
+          for (size_t i = 0; i < start_task.size(); ++i) {
+            if (task_started[i]) {
+              continue;
+            }
             // 检查前置节点是否准备就绪
-            bool is_pre_node_ready = std::all_of(pre_node_list.begin(), pre_node_list.end(), [this](const std::string& pre_node_name) {
-              return node_map_->GetNodePtr(pre_node_name)->GetState() == NodeState::RUNNING;  // 检查节点状态
-            });
-
-            // 如果前置节点为空或准备就绪，启动任务
-            if (is_pre_node_empty || is_pre_node_ready) {
-              task.first = true;                                                         // 标记任务为已启动
-              auto init_node_set = task.second->Init(all_init_node_set);                 // 初始化任务并获取初始化节点集合
-              task.second->TaskStart(task.second->GetTaskSetting().system_setting);      // 启动任务
-              all_init_node_set_log.insert(init_node_set.begin(), init_node_set.end());  // 记录初始化节点
-              task_set_wait_to_start.erase(task.second->GetTaskName());                  // 从等待集合中移除任务
-              logger_->info("[Executer] Task {} start.", task.second->GetTaskName());    // 记录任务启动信息
+            const auto& task = start_task[i];
+            bool is_pre_node_ready = std::all_of(task.pre_node.begin(), task.pre_node.end(),
+                                                 [](const NodeBase* node) { return node->GetState() == NodeState::RUNNING; });
+
+            // 如果前置节点准备就绪，启动任务
+            if (is_pre_node_ready) {
+              task_started[i] = true;                                                // 标记任务为已启动
+              --task_num_wait_to_start;                                              // 减少等待启动的任务数量
+              task.task->Init(task.init_node);                                       // 初始化任务中的指定节点
+              task.task->TaskStart(task.task->GetTaskSetting().system_setting);      // 启动任务
+              logger_->info("[Executer] Task {} start.", task.task->GetTaskName());  // 记录任务启动信息
             }
           }
+          if (task_num_wait_to_start > 0) {
+            StateNotifier::getInstance().WaitChange(state_seq);  // 等待节点状态变化
+          }
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));  // 等待1毫秒
-      }
-      std::set<std::string> running_node_set;  // 运行节点集合
-      for (auto& task : target_task_set_) {
-        for (auto& node : task->GetTaskSetting().node_list) {
-          running_node_set.insert(node.node_name);  // 添加运行节点
+        for (const auto& task : transition_->keep_task) {
+          task.task->Init(task.init_node);                                               // 保持运行的任务只初始化指定节点
+          logger_->info("[Executer] Task {} keeps running.", task.task->GetTaskName());  // 记录任务保持运行信息
+        }
+
+        // 目标任务启动之后再停止其余的当前任务
+        for (auto& task : release_task) {
+          task->TaskStop(executer_config_.executer_setting.idle_system_setting);  // 停止当前任务
         }
+        all_release_task_stop_ = StateNotifier::getInstance().WaitFor(
+            [&release_task, &is_standby] { return std::all_of(release_task.begin(), release_task.end(), is_standby); },
+            executer_config_.executer_setting.timer_setting.period);
+      } else {
+        all_release_task_stop_ = std::all_of(release_task.begin(), release_task.end(), is_standby);  // 检查其余当前任务是否已停止
+      }
+    } else {
+      all_current_task_stop_ = std::all_of(stop_task.begin(), stop_task.end(), is_standby);  // 检查所有当前任务是否已停止
+    }
+
+    if (all_current_task_stop_ && all_release_task_stop_) {  // 如果所有当前任务已停止且目标任务已启动
+      for (auto* node : transition_->release_exit_node) {
+        node->AfterExit();                   // 执行退出后操作
+        node->SetState(NodeState::STANDBY);  // 设置节点状态为待命
       }
       logger_->info(
           "[Executer] Transition from {} to group {} finished.\n      Node State:\n                 - Exit node: {} \n                 - Enter node: {} \n                 - Init node: {}\n                 - Running node: {}\n",
           ColorPrint(current_group_.GetValue(), ColorEnum::YELLOW), ColorPrint(target_group_, ColorEnum::YELLOW),
-          ColorPrint(JointStrSet(exit_node_set_, ","), ColorEnum::BLUE), ColorPrint(JointStrSet(enter_node_set_, ","), ColorEnum::GREEN),
-          ColorPrint(JointStrSet(all_init_node_set_log, ","), ColorEnum::YELLOW),
-          ColorPrint(JointStrSet(running_node_set, ","), ColorEnum::GREEN));  // 记录转换完成信息
+          ColorPrint(transition_->exit_node_log, ColorEnum::BLUE), ColorPrint(transition_->enter_node_log, ColorEnum::GREEN),
+          ColorPrint(transition_->init_node_log, ColorEnum::YELLOW), ColorPrint(transition_->running_node_log, ColorEnum::GREEN));  // 记录转换完成信息
 
-      current_group_ = target_group_;  // 更新当前组
-      is_transition_ = false;          // 重置转换状态
-    } else {
-      all_current_task_stop_ = std::all_of(current_task_set_.begin(), current_task_set_.end(),
-                                           [](const auto& task) { return task->GetState() == TaskState::STANDBY; });  // 检查所有当前任务是否已停止
+      if (transition_trace_start_ != 0) {
+        Trace::Record(TraceCategory::EXECUTER, transition_->trace_name, transition_trace_start_, Trace::Now());  // 记录整个切换过程
+      }
+      current_group_ = target_group_;              // 更新当前组
+      current_group_index_ = target_group_index_;  // 更新当前组下标
+      is_transition_ = false;                      // 重置转换状态
+      if (executer_config_.executer_setting.auto_phase_enable) {
+        phase_assign_time_ = phase_assign_timer_.getNowTime() + kPhaseAssignDelayMs;  // 新的任务组积累运行耗时样本后重新分配相位
+      }
     }
-  } else {
-    // 检查所有节点退出和进入状态
-    all_node_exit_check_ = std::all_of(exit_node_set_.begin(), exit_node_set_.end(),
-                                       [this](const auto& node) { return node_map_->GetNodePtr(node)->TryExit(); });  // 检查退出节点
-    all_node_enter_check_ = std::all_of(enter_node_set_.begin(), enter_node_set_.end(),
-                                        [this](const auto& node) { return node_map_->GetNodePtr(node)->TryEnter(); });  // 检查进入节点
+  }
+}
+
+bool Executer::CheckTransitionNode() {
+  // 不短路，使所有节点的异步检查同时进行
+  bool exit_ready = true;
+  for (const auto* node_list : {&transition_->exit_node, &transition_->release_exit_node}) {
+    for (auto* node : *node_list) {
+      exit_ready = node->CheckExit() && exit_ready;  // 检查退出节点
+    }
+  }
+  bool enter_ready = true;
+  for (auto* node : transition_->enter_node) {
+    enter_ready = node->CheckEnter() && enter_ready;  // 检查进入节点
+  }
+  all_node_exit_check_ = exit_ready;
+  all_node_enter_check_ = enter_ready;
+  return exit_ready && enter_ready;
+}
+
+bool Executer::PrewarmGroup(const std::string& group_name) {
+  if (!transition_plan_ready_.load(std::memory_order_acquire)) {
+    return false;  // 任务尚未创建
+  }
+  auto group_it = group_index_.find(group_name);
+  if (group_it == group_index_.end()) {
+    logger_->error("[Executer] Prewarm group {} is not an exclusive group.", group_name);
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(prewarm_mutex_);
+    if (prewarm_stop_) {
+      return false;
+    }
+    for (auto* node : group_node_[group_it->second]) {
+      if (!node->GetIsConstruct()) {
+        prewarm_queue_.push_back(node);
+      }
+    }
+    if (!prewarm_thread_.joinable()) {
+      prewarm_thread_ = std::thread([this] { PrewarmLoop(); });  // 首次预热时创建预热线程
+    }
+  }
+  prewarm_cv_.notify_one();
+  logger_->info("[Executer] Prewarm group {}.", group_name);
+  return true;
+}
+
+void Executer::PrewarmLoop() {
+  ocm::rt::set_thread_name(executer_config_.executer_setting.package_name + "_prewarm");  // 设置预热线程名称
+  pid_t tid = gettid();
+  ocm::rt::set_thread_priority(tid, 0, SCHED_OTHER);  // 预热线程使用普通调度，不继承调用者的实时优先级
+  const auto& cpu_affinity = executer_config_.executer_setting.idle_system_setting.cpu_affinity;
+  if (executer_config_.executer_setting.all_cpu_affinity_enable && !cpu_affinity.empty()) {
+    ocm::rt::set_thread_cpu_affinity(tid, cpu_affinity);  // 绑定到空闲设置的核心，避免干扰实时任务
+  }
+
+  std::unique_lock<std::mutex> lock(prewarm_mutex_);
+  while (true) {
+    prewarm_cv_.wait(lock, [this] { return prewarm_stop_ || !prewarm_queue_.empty(); });
+    if (prewarm_stop_) {
+      break;
+    }
+    NodeBase* node = prewarm_queue_.front();
+    prewarm_queue_.pop_front();
+    lock.unlock();
+    int64_t start_ns = Monitor::NowNs();
+    if (node->ConstructOnce()) {
+      logger_->info("[Executer] Node {} prewarmed in {:.3f} ms.", node->GetNodeName(), (Monitor::NowNs() - start_ns) * 1e-6);
+    }
+    lock.lock();
+  }
+}
+
+void Executer::StopPrewarm() {
+  {
+    std::lock_guard<std::mutex> lock(prewarm_mutex_);
+    prewarm_stop_ = true;
+    prewarm_queue_.clear();  // 丢弃尚未构造的节点
+  }
+  prewarm_cv_.notify_one();
+  if (prewarm_thread_.joinable()) {
+    prewarm_thread_.join();  // 等待正在构造的节点完成
+  }
+}
+
+void Executer::AssignPhase() {
+  // 按实测执行耗时重新均衡任务内分频节点的相位
+  for (auto& task : resident_group_task_list_) {
+    task.second->BalanceNodePhase();
+  }
+  for (auto& task : standby_group_task_list_) {
+    task.second->BalanceNodePhase();
+  }
+
+  if (!executer_config_.executer_setting.all_cpu_affinity_enable) {
+    logger_->warn("[Executer] Auto phase requires all_cpu_affinity_enable, skipped.");
+    return;
+  }
+
+  // 按相位原点、CPU亲和性与周期对运行中的任务分组，相位只在同一原点的任务之间才能错开唤醒时间
+  std::map<std::tuple<std::string, std::vector<int>, int64_t>, std::vector<std::shared_ptr<Task>>> core_task_map;
+  auto add_task = [&core_task_map](const std::shared_ptr<Task>& task) {
+    const auto& task_setting = task->GetTaskSetting();
+    if (task->GetState() != TaskState::RUNNING || task_setting.system_setting.cpu_affinity.empty() ||
+        task_setting.timer_setting.timer_type == TimerType::TRIGGER || task_setting.timer_setting.timer_type == TimerType::TOPIC_TRIGGER) {
+      return;  // 未绑定CPU或非周期任务不参与分配
+    }
+    std::string time_base;  // 内部、混合自旋与时间轮定时器均以`CLOCK_MONOTONIC`的绝对网格为原点
+    if (task_setting.timer_setting.timer_type == TimerType::EXTERNAL_TIMER) {
+      time_base = "external:" + (task_setting.timer_setting.clock_name.empty() ? task_setting.task_name : task_setting.timer_setting.clock_name);
+    } else if (task_setting.timer_setting.timer_type == TimerType::SIMULATED) {
+      time_base = "simulated";
+    }
+    std::vector<int> cpu_affinity = task_setting.system_setting.cpu_affinity;
+    std::sort(cpu_affinity.begin(), cpu_affinity.end());
+    core_task_map[{time_base, cpu_affinity, std::llround(task_setting.timer_setting.period * 1e9)}].push_back(task);
+  };
+  for (auto& task : resident_group_task_list_) {
+    add_task(task.second);
+  }
+  for (auto& task : standby_group_task_list_) {
+    add_task(task.second);
+  }
+
+  for (auto& [key, task_list] : core_task_map) {
+    if (task_list.size() < 2) {
+      continue;
+    }
+    // 高优先级的任务排在周期起点
+    std::sort(task_list.begin(), task_list.end(), [](const auto& lhs, const auto& rhs) {
+      const auto& lhs_setting = lhs->GetTaskSetting();
+      const auto& rhs_setting = rhs->GetTaskSetting();
+      if (lhs_setting.system_setting.priority != rhs_setting.system_setting.priority) {
+        return lhs_setting.system_setting.priority > rhs_setting.system_setting.priority;
+      }
+      return lhs_setting.task_name < rhs_setting.task_name;
+    });
+
+    double period = static_cast<double>(std::get<2>(key)) / 1e9;  // 周期，以秒为单位
+    std::vector<double> run_time_list;                            // 各任务的运行耗时p99，以秒为单位
+    double total_run_time = 0.0;
+    for (auto& task : task_list) {
+      HistogramSummary summary = task->GetRunTimeSummary();
+      run_time_list.push_back(summary.count > 0 ? static_cast<double>(summary.p99) / 1e9 : 0.0);
+      total_run_time += run_time_list.back();
+    }
+    double scale = total_run_time > period ? period / total_run_time : 1.0;  // 总运行耗时超过周期时按比例压缩
+    double gap = (period - total_run_time * scale) / static_cast<double>(task_list.size());  // 剩余时间平均分配为间隔
+
+    double phase = 0.0;
+    for (size_t i = 0; i < task_list.size(); ++i) {
+      task_list[i]->SetPhase(phase);
+      logger_->info("[Executer] Task {} phase {:.3f} ms, run time p99 {:.3f} ms.", task_list[i]->GetTaskName(), phase * 1e3, run_time_list[i] * 1e3);
+      phase += run_time_list[i] * scale + gap;
+    }
+  }
+}
+
+void Executer::ConnectPort() {
+  auto find_port = [this](const std::string& path, PortDirection direction) {
+    size_t dot = path.rfind('.');
+    if (dot == std::string::npos) {
+      throw std::runtime_error("[Executer] Invalid port " + path + ", expected node_name.port_name.");
+    }
+    PortBase* port = node_map_->GetNodePtr(path.substr(0, dot))->GetPort(path.substr(dot + 1), direction);
+    if (!port) {
+      throw std::runtime_error("[Executer] Port " + path + " not found.");
+    }
+    return port;
+  };
+  for (const auto& connection : executer_config_.port_connection) {
+    PortBase::Connect(*find_port(connection.output, PortDirection::OUTPUT), *find_port(connection.input, PortDirection::INPUT));
+    logger_->info("[Executer] Port {} connected to {}.", connection.output, connection.input);
   }
 }
 
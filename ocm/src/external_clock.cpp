@@ -0,0 +1,50 @@
+#include "task/external_clock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "common/futex.hpp"
+#include "monitor/monitor.hpp"
+
+namespace ocm {
+
+ExternalClock::ExternalClock(const std::string& name, double tick_period) {
+  if (tick_period <= 0) {
+    throw std::runtime_error("[ExternalClock] Tick period must be positive.");
+  }
+  uint64_t tick_period_ns = std::max<uint64_t>(1, static_cast<uint64_t>(std::llround(tick_period * 1e9)));
+
+  shm_ = std::make_unique<SharedMemoryData<ExternalClockSegment>>(name, true, sizeof(ExternalClockSegment));
+  segment_ = shm_->Get();
+  shm_->Lock();
+  if (segment_->magic.load() != kExternalClockMagic) {
+    segment_->tick.store(0);  // 首次创建的时钟段
+  }
+  uint64_t tick = segment_->tick.load();
+  segment_->tick_period_ns.store(tick_period_ns);
+  segment_->epoch_ns.store(Monitor::NowNs() - static_cast<int64_t>(tick * tick_period_ns));  // 沿用已有节拍计数，使当前节拍对应当前时间
+  segment_->magic.store(kExternalClockMagic, std::memory_order_release);
+  shm_->UnLock();
+
+  segment_->seq.fetch_add(1);
+  FutexWake(&segment_->seq, INT_MAX, true);  // 唤醒等待时钟源启动的订阅者
+}
+
+void ExternalClock::Tick() { Publish(segment_->tick.load(std::memory_order_relaxed) + 1); }
+
+void ExternalClock::Publish(uint64_t tick) {
+  if (tick < segment_->tick.load(std::memory_order_relaxed)) {
+    return;  // 节拍计数只增不减
+  }
+  segment_->tick.store(tick, std::memory_order_release);
+  segment_->seq.fetch_add(1);
+  if (segment_->waiters.load() > 0) {
+    FutexWake(&segment_->seq, INT_MAX, true);  // 仅在有订阅者等待时进入内核
+  }
+}
+
+uint64_t ExternalClock::GetTick() const { return segment_->tick.load(std::memory_order_acquire); }
+
+double ExternalClock::GetTickPeriod() const { return static_cast<double>(segment_->tick_period_ns.load()) / 1e9; }
+
+}  // namespace ocm
@@ -0,0 +1,57 @@
+#include "common/histogram.hpp"
+
+#include <algorithm>
+
+namespace ocm {
+
+void LatencyHistogram::Reset() {
+  count.store(0, std::memory_order_relaxed);
+  sum.store(0, std::memory_order_relaxed);
+  min.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+  max.store(0, std::memory_order_relaxed);
+  for (auto& bucket : buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+HistogramSummary LatencyHistogram::Summary() const {
+  HistogramSummary summary;
+  uint64_t counts[kBucketNum];
+  uint64_t total = 0;
+  for (int i = 0; i < kBucketNum; ++i) {
+    counts[i] = buckets[i].load(std::memory_order_relaxed);
+    total += counts[i];  // 以桶计数之和为准，避免与count不一致
+  }
+  if (total == 0) {
+    return summary;
+  }
+
+  summary.count = total;
+  summary.min = min.load(std::memory_order_relaxed);
+  summary.max = max.load(std::memory_order_relaxed);
+  summary.mean = static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(total);
+
+  const double quantiles[3] = {0.5, 0.99, 0.999};
+  int64_t* results[3] = {&summary.p50, &summary.p99, &summary.p999};
+  uint64_t cumulative = 0;
+  int q = 0;
+  for (int i = 0; i < kBucketNum && q < 3; ++i) {
+    cumulative += counts[i];
+    while (q < 3 && static_cast<double>(cumulative) >= quantiles[q] * static_cast<double>(total)) {
+      *results[q] = std::min(BucketUpperBound(i), summary.max);  // 分位数不超过实际最大值
+      ++q;
+    }
+  }
+  return summary;
+}
+
+int64_t LatencyHistogram::BucketUpperBound(int index) {
+  if (index < kSubBucketNum) {
+    return index;
+  }
+  int shift = index / kSubBucketNum - 1;
+  int64_t mantissa = index % kSubBucketNum + kSubBucketNum;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+}  // namespace ocm
@@ -0,0 +1,327 @@
+#include "bridge/lcm_bridge.hpp"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace ocm {
+
+namespace {
+
+constexpr uint32_t kLcmShortMagic = 0x4c433032;  // LCM短报文魔数 "LC02"
+constexpr size_t kLcmShortMaxSize = 65499;       // LCM短报文数据报的最大字节数
+
+int64_t MonotonicNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+}  // namespace
+
+LcmBridge::LcmBridge(const LcmBridgeConfig& config)
+    : TaskBase("lcm_bridge", TimerType::INTERNAL_TIMER, 0.0, config.all_priority_enable, config.all_cpu_affinity_enable),
+      config_(config),
+      send_fd_(-1),
+      recv_fd_(-1),
+      send_port_(0),
+      sequence_(0) {
+  send_source_.s_addr = htonl(INADDR_ANY);
+  logger_ = GetLogger();  // 获取日志记录器
+  send_count_.store(0);
+  receive_count_.store(0);
+  drop_count_.store(0);
+  if (config_.batch_size == 0) {
+    config_.batch_size = 1;  // 至少每次处理一条报文
+  }
+
+  OpenSocket();  // 创建收发套接字
+
+  // 初始化出站话题，预先写好LCM头与通道名
+  outbound_.resize(config_.outbound.size());
+  for (size_t i = 0; i < config_.outbound.size(); ++i) {
+    auto& topic = outbound_[i];
+    topic.config = config_.outbound[i];
+    topic.sem = std::make_unique<SharedMemorySemaphore>(topic.config.topic_name, 0);
+    topic.header_size = 8 + topic.config.channel.size() + 1;
+    topic.datagram.resize(topic.header_size);
+    uint32_t magic = htonl(kLcmShortMagic);
+    std::memcpy(topic.datagram.data(), &magic, sizeof(magic));
+    std::memcpy(topic.datagram.data() + 8, topic.config.channel.c_str(), topic.config.channel.size() + 1);
+    topic.min_interval_ns = topic.config.max_rate > 0 ? static_cast<int64_t>(1e9 / topic.config.max_rate) : 0;
+    logger_->info("[LcmBridge] Outbound {} -> {} added.", topic.config.topic_name, topic.config.channel);
+  }
+
+  // 初始化入站话题
+  inbound_.resize(config_.inbound.size());
+  for (size_t i = 0; i < config_.inbound.size(); ++i) {
+    auto& topic = inbound_[i];
+    topic.config = config_.inbound[i];
+    topic.sem = std::make_unique<SharedMemorySemaphore>(topic.config.topic_name, 0);
+    topic.monitor = Monitor::getInstance().GetTopic(topic.config.shm_name);
+    topic.signal = TopicSignal::getInstance().GetSlot(topic.config.topic_name);
+    inbound_index_[topic.config.channel] = i;
+    logger_->info("[LcmBridge] Inbound {} -> {} added.", topic.config.channel, topic.config.topic_name);
+  }
+
+  // 预分配批量收发所需的结构
+  send_msgs_.resize(config_.batch_size);
+  send_iovs_.resize(config_.batch_size);
+  recv_buffers_.assign(config_.batch_size, std::vector<uint8_t>(kLcmShortMaxSize));
+  recv_msgs_.resize(config_.batch_size);
+  recv_iovs_.resize(config_.batch_size);
+  recv_addrs_.resize(config_.batch_size);
+  for (size_t i = 0; i < config_.batch_size; ++i) {
+    std::memset(&send_msgs_[i], 0, sizeof(mmsghdr));
+    send_msgs_[i].msg_hdr.msg_name = &dest_addr_;
+    send_msgs_[i].msg_hdr.msg_namelen = sizeof(dest_addr_);
+    send_msgs_[i].msg_hdr.msg_iov = &send_iovs_[i];
+    send_msgs_[i].msg_hdr.msg_iovlen = 1;
+
+    recv_iovs_[i].iov_base = recv_buffers_[i].data();
+    recv_iovs_[i].iov_len = recv_buffers_[i].size();
+    std::memset(&recv_msgs_[i], 0, sizeof(mmsghdr));
+    recv_msgs_[i].msg_hdr.msg_name = &recv_addrs_[i];
+    recv_msgs_[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  SetPeriod(config_.period);          // 设置轮询周期
+  TaskStart(config_.system_setting);  // 启动任务
+}
+
+LcmBridge::~LcmBridge() {
+  if (send_fd_ >= 0) {
+    close(send_fd_);
+  }
+  if (recv_fd_ >= 0) {
+    close(recv_fd_);
+  }
+}
+
+void LcmBridge::OpenSocket() {
+  in_addr interface_addr;
+  if (inet_pton(AF_INET, config_.interface_ip.c_str(), &interface_addr) != 1) {
+    throw std::runtime_error("[LcmBridge] Invalid interface ip: " + config_.interface_ip);
+  }
+  std::memset(&dest_addr_, 0, sizeof(dest_addr_));
+  dest_addr_.sin_family = AF_INET;
+  dest_addr_.sin_port = htons(static_cast<uint16_t>(config_.port));
+  if (inet_pton(AF_INET, config_.multicast_ip.c_str(), &dest_addr_.sin_addr) != 1) {
+    throw std::runtime_error("[LcmBridge] Invalid multicast ip: " + config_.multicast_ip);
+  }
+
+  // 发送套接字：多播TTL、出口网卡、开启回环以便本机订阅者接收
+  send_fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (send_fd_ < 0) {
+    throw std::runtime_error("[LcmBridge] Failed to create send socket: " + std::string(strerror(errno)));
+  }
+  unsigned char ttl = static_cast<unsigned char>(config_.ttl);
+  unsigned char loop = 1;
+  if (setsockopt(send_fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) != 0 ||
+      setsockopt(send_fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) != 0 ||
+      setsockopt(send_fd_, IPPROTO_IP, IP_MULTICAST_IF, &interface_addr, sizeof(interface_addr)) != 0) {
+    throw std::runtime_error("[LcmBridge] Failed to configure send socket: " + std::string(strerror(errno)));
+  }
+  sockaddr_in send_addr;
+  std::memset(&send_addr, 0, sizeof(send_addr));
+  send_addr.sin_family = AF_INET;
+  send_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  socklen_t send_addr_len = sizeof(send_addr);
+  if (bind(send_fd_, reinterpret_cast<sockaddr*>(&send_addr), sizeof(send_addr)) != 0 ||
+      getsockname(send_fd_, reinterpret_cast<sockaddr*>(&send_addr), &send_addr_len) != 0) {
+    throw std::runtime_error("[LcmBridge] Failed to bind send socket: " + std::string(strerror(errno)));
+  }
+  send_port_ = ntohs(send_addr.sin_port);
+
+  // 发送套接字绑定在任意地址上，通过一个连接到多播地址的临时套接字取得路由选择的源地址，用于过滤自身回环报文
+  int probe_fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in probe_addr;
+  socklen_t probe_addr_len = sizeof(probe_addr);
+  if (probe_fd < 0 || setsockopt(probe_fd, IPPROTO_IP, IP_MULTICAST_IF, &interface_addr, sizeof(interface_addr)) != 0 ||
+      connect(probe_fd, reinterpret_cast<const sockaddr*>(&dest_addr_), sizeof(dest_addr_)) != 0 ||
+      getsockname(probe_fd, reinterpret_cast<sockaddr*>(&probe_addr), &probe_addr_len) != 0) {
+    std::string error = strerror(errno);
+    if (probe_fd >= 0) {
+      close(probe_fd);
+    }
+    throw std::runtime_error("[LcmBridge] Failed to resolve send source address: " + error);
+  }
+  close(probe_fd);
+  send_source_ = probe_addr.sin_addr;
+
+  if (config_.inbound.empty()) {
+    return;  // 无入站话题时无需接收套接字
+  }
+
+  // 接收套接字：与其它LCM实例共享端口并加入多播组
+  recv_fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (recv_fd_ < 0) {
+    throw std::runtime_error("[LcmBridge] Failed to create receive socket: " + std::string(strerror(errno)));
+  }
+  int reuse = 1;
+  setsockopt(recv_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  setsockopt(recv_fd_, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse));
+  sockaddr_in recv_addr;
+  std::memset(&recv_addr, 0, sizeof(recv_addr));
+  recv_addr.sin_family = AF_INET;
+  recv_addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  recv_addr.sin_port = htons(static_cast<uint16_t>(config_.port));
+  if (bind(recv_fd_, reinterpret_cast<sockaddr*>(&recv_addr), sizeof(recv_addr)) != 0) {
+    throw std::runtime_error("[LcmBridge] Failed to bind receive socket: " + std::string(strerror(errno)));
+  }
+  ip_mreq mreq;
+  mreq.imr_multiaddr = dest_addr_.sin_addr;
+  mreq.imr_interface = interface_addr;
+  if (setsockopt(recv_fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0) {
+    throw std::runtime_error("[LcmBridge] Failed to join multicast group: " + std::string(strerror(errno)));
+  }
+}
+
+void LcmBridge::Run() {
+  if (recv_fd_ >= 0) {
+    ReceiveInbound();  // 先处理入站报文
+  }
+  SendOutbound(MonotonicNs());  // 再批量发送出站报文
+}
+
+void LcmBridge::ReceiveInbound() {
+  while (true) {
+    for (size_t i = 0; i < config_.batch_size; ++i) {
+      recv_msgs_[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);  // 每次接收前重置源地址长度
+    }
+    int count = recvmmsg(recv_fd_, recv_msgs_.data(), static_cast<unsigned int>(config_.batch_size), MSG_DONTWAIT, nullptr);
+    if (count <= 0) {
+      if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        logger_->error("[LcmBridge] recvmmsg failed: {}", strerror(errno));
+      }
+      return;
+    }
+
+    for (int i = 0; i < count; ++i) {
+      if (recv_addrs_[i].sin_addr.s_addr == send_source_.s_addr && ntohs(recv_addrs_[i].sin_port) == send_port_) {
+        continue;  // 忽略自身发出的回环报文，其它主机的发送者可能恰好使用相同的端口，因此同时比较源地址
+      }
+      const uint8_t* data = recv_buffers_[i].data();
+      size_t length = recv_msgs_[i].msg_len;
+      uint32_t magic = 0;
+      if (length >= sizeof(magic)) {
+        std::memcpy(&magic, data, sizeof(magic));
+      }
+      if (length < 9 || ntohl(magic) != kLcmShortMagic) {
+        drop_count_.fetch_add(1);  // 非LCM短报文（含分片报文）
+        continue;
+      }
+      const char* channel = reinterpret_cast<const char*>(data + 8);
+      size_t channel_len = strnlen(channel, length - 8);
+      if (channel_len == length - 8) {
+        drop_count_.fetch_add(1);  // 通道名未以'\0'结尾
+        continue;
+      }
+      auto it = inbound_index_.find(std::string(channel, channel_len));
+      if (it == inbound_index_.end()) {
+        continue;  // 未配置的通道
+      }
+
+      auto& topic = inbound_[it->second];
+      const uint8_t* payload = data + 8 + channel_len + 1;
+      size_t payload_len = length - 8 - channel_len - 1;
+      try {
+        if (!topic.shm) {
+          topic.shm = std::make_unique<SharedMemoryData<uint8_t>>(topic.config.shm_name, true, payload_len);
+        }
+        if (static_cast<size_t>(topic.shm->GetSize()) < payload_len) {
+          drop_count_.fetch_add(1);  // 负载超过共享内存段大小
+          continue;
+        }
+        topic.shm->Lock();
+        std::memcpy(topic.shm->Get(), payload, payload_len);
+        topic.shm->UnLock();
+        topic.sem->IncrementWhenZero();                   // 通知订阅者
+        TopicSignal::getInstance().Notify(topic.signal);  // 与本地发布一样唤醒绑定该话题的触发任务
+        if (topic.monitor) {
+          topic.monitor->OnPublish(static_cast<uint32_t>(payload_len));  // 桥接写入视为一次发布
+        }
+        receive_count_.fetch_add(1);
+      } catch (const std::runtime_error& e) {
+        drop_count_.fetch_add(1);
+        logger_->error("[LcmBridge] Inbound {} failed: {}", topic.config.channel, e.what());
+      }
+    }
+
+    if (static_cast<size_t>(count) < config_.batch_size) {
+      return;  // 接收队列已清空
+    }
+  }
+}
+
+void LcmBridge::SendOutbound(int64_t now_ns) {
+  size_t batch = 0;
+  for (auto& topic : outbound_) {
+    if (topic.sem->TryDecrement()) {
+      topic.pending = true;  // 记录新数据，限频期间只保留最新一份
+    }
+    if (!topic.pending || now_ns - topic.last_send_ns < topic.min_interval_ns) {
+      continue;
+    }
+    if (!topic.shm) {
+      topic.shm = std::make_unique<SharedMemoryData<uint8_t>>(topic.config.shm_name, false);
+    }
+
+    size_t payload_len = static_cast<size_t>(topic.shm->GetSize());
+    if (topic.header_size + payload_len > kLcmShortMaxSize) {
+      topic.pending = false;
+      drop_count_.fetch_add(1);
+      logger_->warn("[LcmBridge] Topic {} payload {} bytes exceeds LCM short message limit, dropped.", topic.config.topic_name, payload_len);
+      continue;
+    }
+
+    // 负载已是LCM编码，直接拷贝，无需解码再编码
+    topic.datagram.resize(topic.header_size + payload_len);
+    uint32_t sequence = htonl(sequence_++);
+    std::memcpy(topic.datagram.data() + 4, &sequence, sizeof(sequence));
+    topic.shm->Lock();
+    std::memcpy(topic.datagram.data() + topic.header_size, topic.shm->Get(), payload_len);
+    topic.shm->UnLock();
+    topic.pending = false;
+    topic.last_send_ns = now_ns;
+
+    send_iovs_[batch].iov_base = topic.datagram.data();
+    send_iovs_[batch].iov_len = topic.datagram.size();
+    if (++batch == config_.batch_size) {
+      FlushBatch(batch);
+      batch = 0;
+    }
+  }
+  if (batch > 0) {
+    FlushBatch(batch);
+  }
+}
+
+void LcmBridge::FlushBatch(size_t count) {
+  size_t sent = 0;
+  while (sent < count) {
+    int result = sendmmsg(send_fd_, send_msgs_.data() + sent, static_cast<unsigned int>(count - sent), 0);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      drop_count_.fetch_add(count - sent);
+      logger_->error("[LcmBridge] sendmmsg failed: {}", strerror(errno));
+      return;
+    }
+    sent += static_cast<size_t>(result);
+  }
+  send_count_.fetch_add(count);
+}
+
+uint64_t LcmBridge::GetSendCount() const { return send_count_.load(); }
+
+uint64_t LcmBridge::GetReceiveCount() const { return receive_count_.load(); }
+
+uint64_t LcmBridge::GetDropCount() const { return drop_count_.load(); }
+
+}  // namespace ocm
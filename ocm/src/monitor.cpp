@@ -0,0 +1,236 @@
+#include "monitor/monitor.hpp"
+
+#include <signal.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include "log_anywhere/log_anywhere.hpp"
+
+namespace ocm {
+
+namespace {
+
+/**
+ * @brief 判断进程是否仍然存活。
+ */
+bool IsProcessAlive(int32_t pid) { return pid > 0 && (kill(pid, 0) == 0 || errno != ESRCH); }
+
+/**
+ * @brief 以截断方式拷贝名称。
+ */
+void CopyName(char* dst, const std::string& src) {
+  std::strncpy(dst, src.c_str(), kMonitorNameSize - 1);
+  dst[kMonitorNameSize - 1] = '\0';
+}
+
+}  // namespace
+
+void MonitorTaskSlot::Update(uint8_t state, double loop_duration_ms, double run_duration_ms, uint64_t miss_count, int64_t now_ns) {
+  uint32_t begin = seq.load(std::memory_order_relaxed);
+  seq.store(begin + 1, std::memory_order_relaxed);  // 标记写入开始
+  std::atomic_thread_fence(std::memory_order_release);
+  this->state.store(state, std::memory_order_relaxed);
+  this->loop_duration_ms.store(loop_duration_ms, std::memory_order_relaxed);
+  this->run_duration_ms.store(run_duration_ms, std::memory_order_relaxed);
+  if (run_duration_ms > max_run_duration_ms.load(std::memory_order_relaxed)) {
+    max_run_duration_ms.store(run_duration_ms, std::memory_order_relaxed);
+  }
+  loop_count.store(loop_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  this->miss_count.store(miss_count, std::memory_order_relaxed);
+  last_run_ns.store(now_ns, std::memory_order_relaxed);
+  seq.store(begin + 2, std::memory_order_release);  // 标记写入结束
+}
+
+MonitorTaskSnapshot MonitorTaskSlot::Read() const {
+  MonitorTaskSnapshot snapshot;
+  uint32_t begin, end;
+  do {
+    begin = seq.load(std::memory_order_acquire);
+    snapshot.pid = pid.load(std::memory_order_relaxed);
+    snapshot.tid = tid.load(std::memory_order_relaxed);
+    snapshot.state = state.load(std::memory_order_relaxed);
+    snapshot.period_ms = period_ms.load(std::memory_order_relaxed);
+    snapshot.loop_duration_ms = loop_duration_ms.load(std::memory_order_relaxed);
+    snapshot.run_duration_ms = run_duration_ms.load(std::memory_order_relaxed);
+    snapshot.max_run_duration_ms = max_run_duration_ms.load(std::memory_order_relaxed);
+    snapshot.loop_count = loop_count.load(std::memory_order_relaxed);
+    snapshot.miss_count = miss_count.load(std::memory_order_relaxed);
+    snapshot.last_run_ns = last_run_ns.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    end = seq.load(std::memory_order_relaxed);
+  } while ((begin & 1) || begin != end);  // 写入过程中读取则重试
+  snapshot.name.assign(name, strnlen(name, kMonitorNameSize));
+  return snapshot;
+}
+
+void MonitorTopicSlot::OnPublish(uint32_t size) {
+  this->size.store(size, std::memory_order_relaxed);
+  last_publish_ns.store(Monitor::NowNs(), std::memory_order_relaxed);
+  publish_count.fetch_add(1, std::memory_order_release);
+}
+
+void MonitorTopicSlot::OnReceive() {
+  int64_t latency = Monitor::NowNs() - last_publish_ns.load(std::memory_order_relaxed);
+  uint32_t index = latency_index.fetch_add(1, std::memory_order_relaxed) % kMonitorLatencySampleNum;
+  latency_ns[index].store(latency, std::memory_order_relaxed);
+  receive_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+MonitorTopicSnapshot MonitorTopicSlot::Read() const {
+  MonitorTopicSnapshot snapshot;
+  snapshot.name.assign(name, strnlen(name, kMonitorNameSize));
+  snapshot.publish_count = publish_count.load(std::memory_order_acquire);
+  snapshot.receive_count = receive_count.load(std::memory_order_relaxed);
+  snapshot.size = size.load(std::memory_order_relaxed);
+  snapshot.last_publish_ns = last_publish_ns.load(std::memory_order_relaxed);
+  uint32_t sample_num = std::min<uint32_t>(latency_index.load(std::memory_order_relaxed), kMonitorLatencySampleNum);
+  snapshot.latency_ns.reserve(sample_num);
+  for (uint32_t i = 0; i < sample_num; ++i) {
+    snapshot.latency_ns.push_back(latency_ns[i].load(std::memory_order_relaxed));
+  }
+  return snapshot;
+}
+
+Monitor::Monitor() : segment_(nullptr) {
+  try {
+    shm_ = std::make_unique<SharedMemoryData<MonitorSegment>>(kMonitorShmName, true, sizeof(MonitorSegment));
+    shm_->Lock();
+    uint32_t magic = shm_->Get()->magic.load();
+    if (magic == 0) {
+      shm_->Get()->magic.store(kMonitorMagic);  // 首次创建的共享内存段
+      magic = kMonitorMagic;
+    }
+    shm_->UnLock();
+    if (magic == kMonitorMagic) {
+      segment_ = shm_->Get();
+    } else {
+      GetLogger()->error("[Monitor] Shared memory layout mismatch, monitor disabled.");
+    }
+  } catch (const std::runtime_error& e) {
+    GetLogger()->error("[Monitor] {}, monitor disabled.", e.what());
+  }
+}
+
+Monitor::~Monitor() = default;
+
+Monitor& Monitor::getInstance() {
+  static Monitor instance;
+  return instance;
+}
+
+MonitorTaskSlot* Monitor::RegisterTask(const std::string& name) {
+  if (!segment_) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  shm_->Lock();
+  MonitorTaskSlot* result = nullptr;
+  for (auto& slot : segment_->task_slot) {
+    if (slot.slot_state.load() == MonitorSlotState::FREE || !IsProcessAlive(slot.pid.load())) {
+      result = &slot;
+      break;
+    }
+  }
+  if (result) {
+    result->seq.store(0);
+    result->pid.store(getpid());
+    result->tid.store(0);
+    CopyName(result->name, name);
+    result->state.store(0);
+    result->period_ms.store(0.0);
+    result->loop_duration_ms.store(0.0);
+    result->run_duration_ms.store(0.0);
+    result->max_run_duration_ms.store(0.0);
+    result->loop_count.store(0);
+    result->miss_count.store(0);
+    result->wake_latency.Reset();
+    result->run_time.Reset();
+    result->last_run_ns.store(0);
+    result->slot_state.store(MonitorSlotState::READY, std::memory_order_release);
+  }
+  shm_->UnLock();
+  if (!result) {
+    GetLogger()->warn("[Monitor] Task slots are full, task {} is not monitored.", name);
+  }
+  return result;
+}
+
+void Monitor::UnregisterTask(MonitorTaskSlot* slot) {
+  if (slot) {
+    slot->slot_state.store(MonitorSlotState::FREE, std::memory_order_release);
+  }
+}
+
+MonitorNodeSlot* Monitor::RegisterNode(const std::string& name, const std::string& task_name) {
+  if (!segment_) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  shm_->Lock();
+  MonitorNodeSlot* result = nullptr;
+  for (auto& slot : segment_->node_slot) {
+    if (slot.slot_state.load() == MonitorSlotState::FREE || !IsProcessAlive(slot.pid.load())) {
+      result = &slot;
+      break;
+    }
+  }
+  if (result) {
+    result->pid.store(getpid());
+    CopyName(result->name, name);
+    CopyName(result->task_name, task_name);
+    result->profile.Reset();
+    result->slot_state.store(MonitorSlotState::READY, std::memory_order_release);
+  }
+  shm_->UnLock();
+  if (!result) {
+    GetLogger()->warn("[Monitor] Node slots are full, node {} is not monitored.", name);
+  }
+  return result;
+}
+
+void Monitor::UnregisterNode(MonitorNodeSlot* slot) {
+  if (slot) {
+    slot->slot_state.store(MonitorSlotState::FREE, std::memory_order_release);
+  }
+}
+
+MonitorTopicSlot* Monitor::GetTopic(const std::string& name) {
+  if (!segment_) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  shm_->Lock();
+  MonitorTopicSlot* result = nullptr;
+  MonitorTopicSlot* free_slot = nullptr;
+  for (auto& slot : segment_->topic_slot) {
+    if (slot.slot_state.load() == MonitorSlotState::READY) {
+      if (std::strncmp(slot.name, name.c_str(), kMonitorNameSize - 1) == 0) {
+        result = &slot;
+        break;
+      }
+    } else if (!free_slot) {
+      free_slot = &slot;
+    }
+  }
+  if (!result && free_slot) {
+    result = free_slot;
+    CopyName(result->name, name);
+    result->slot_state.store(MonitorSlotState::READY, std::memory_order_release);
+  }
+  shm_->UnLock();
+  if (!result) {
+    GetLogger()->warn("[Monitor] Topic slots are full, topic {} is not monitored.", name);
+  }
+  return result;
+}
+
+const MonitorSegment* Monitor::GetSegment() const { return segment_; }
+
+int64_t Monitor::NowNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+}  // namespace ocm
@@ -1,12 +1,22 @@
 #include "node/node.hpp"
 
+#include <stdexcept>
+#include "common/state_notifier.hpp"
+
 namespace ocm {
 
 NodeBase::NodeBase(const std::string& node_name) : node_name_(node_name) {
-  state_.store(NodeState::INIT);  // 初始化节点状态为INIT
+  state_.store(NodeState::INIT);               // 初始化节点状态为INIT
+  enter_check_.store(NodeCheckState::IDLE);  // 初始化进入检查状态
+  exit_check_.store(NodeCheckState::IDLE);   // 初始化退出检查状态
+}
+NodeBase::~NodeBase() {
+  Monitor::getInstance().UnregisterNode(monitor_slot_);  // 释放节点耗时监控槽位
 }
 void NodeBase::SetState(NodeState state) {
-  state_.store(state);  // 设置节点状态
+  if (state_.exchange(state) != state) {
+    StateNotifier::getInstance().Notify();  // 状态变化时唤醒等待者
+  }
 }
 NodeState NodeBase::GetState() const {
   return state_.load();  // 获取当前节点状态
@@ -15,10 +25,104 @@ const std::string& NodeBase::GetNodeName() const {
   return node_name_;  // 返回节点名称
 }
 bool NodeBase::GetIsConstruct() const {
-  return is_construct_;  // 返回节点是否构造
+  return is_construct_.load(std::memory_order_acquire);  // 返回节点是否构造
 }
 void NodeBase::SetIsConstruct(bool is_construct) {
-  is_construct_ = is_construct;  // 设置节点是否构造
+  is_construct_.store(is_construct, std::memory_order_release);  // 设置节点是否构造
+}
+void NodeBase::TryEnterAsync(std::function<void(bool)> done) {
+  done(TryEnter());  // 默认同步检查
+}
+void NodeBase::TryExitAsync(std::function<void(bool)> done) {
+  done(TryExit());  // 默认同步检查
+}
+bool NodeBase::CheckEnter() { return RunTransitionCheck(enter_check_, true); }
+bool NodeBase::CheckExit() { return RunTransitionCheck(exit_check_, false); }
+void NodeBase::ResetTransitionCheck() {
+  NodeCheckState passed = NodeCheckState::PASSED;
+  enter_check_.compare_exchange_strong(passed, NodeCheckState::IDLE);  // 只清除已通过的结果，保留进行中的检查
+  passed = NodeCheckState::PASSED;
+  exit_check_.compare_exchange_strong(passed, NodeCheckState::IDLE);
+}
+bool NodeBase::RunTransitionCheck(std::atomic<NodeCheckState>& check, bool enter) {
+  NodeCheckState state = check.load(std::memory_order_acquire);
+  if (state != NodeCheckState::IDLE) {
+    return state == NodeCheckState::PASSED;  // 检查已通过或仍在进行中
+  }
+  check.store(NodeCheckState::PENDING, std::memory_order_relaxed);
+  auto done = [&check](bool ready) {
+    check.store(ready ? NodeCheckState::PASSED : NodeCheckState::IDLE, std::memory_order_release);
+    if (ready) {
+      StateNotifier::getInstance().Notify();  // 检查通过时唤醒执行器，未通过时由执行器稍后重新发起，避免同步检查反复唤醒
+    }
+  };
+  if (enter) {
+    TryEnterAsync(done);
+  } else {
+    TryExitAsync(done);
+  }
+  return check.load(std::memory_order_acquire) == NodeCheckState::PASSED;  // 同步完成的检查立即得到结果
+}
+bool NodeBase::ConstructOnce() {
+  std::lock_guard<std::mutex> lock(construct_mutex_);
+  if (is_construct_.load(std::memory_order_relaxed)) {
+    return false;  // 已由其它线程构造
+  }
+  Construct();                                           // 构造节点
+  is_construct_.store(true, std::memory_order_release);  // 设置节点构造标志
+  return true;
+}
+
+NodeProfile* NodeBase::EnableProfile(const std::string& task_name) {
+  NodeProfile* profile = profile_.load();
+  if (profile) {
+    return profile;  // 已启用
+  }
+  monitor_slot_ = Monitor::getInstance().RegisterNode(node_name_, task_name);  // 登记节点耗时监控槽位
+  if (monitor_slot_) {
+    profile = &monitor_slot_->profile;  // 耗时统计直接写入共享内存
+  } else {
+    local_profile_ = std::make_unique<NodeProfile>();
+    profile = local_profile_.get();
+  }
+  profile_.store(profile);
+  return profile;
+}
+NodeProfile* NodeBase::GetProfile() const {
+  return profile_.load(std::memory_order_acquire);  // 返回节点耗时统计
+}
+HistogramSummary NodeBase::GetProfileSummary(NodePhase phase) const {
+  NodeProfile* profile = GetProfile();
+  return profile ? profile->Summary(phase) : HistogramSummary{};
+}
+NodeWorstCase NodeBase::GetWorstCase(NodePhase phase) const {
+  NodeProfile* profile = GetProfile();
+  return profile ? profile->Worst(phase) : NodeWorstCase{};
+}
+PortBase* NodeBase::GetPort(const std::string& port_name, PortDirection direction) const {
+  const auto& port_list = direction == PortDirection::INPUT ? input_port_ : output_port_;
+  for (auto* port : port_list) {
+    if (port->GetName() == port_name) {
+      return port;
+    }
+  }
+  return nullptr;
+}
+void NodeBase::LatchInputs() {
+  for (auto* port : input_port_) {
+    port->Latch();  // 锁存输入端口
+  }
+}
+void NodeBase::PublishOutputs() {
+  for (auto* port : output_port_) {
+    port->Publish();  // 发布输出端口
+  }
+}
+void NodeBase::RegisterPort(PortBase* port) {
+  if (GetPort(port->GetName(), port->GetDirection())) {
+    throw std::runtime_error("[NodeBase] Node " + node_name_ + " already has port " + port->GetName() + ".");
+  }
+  (port->GetDirection() == PortDirection::INPUT ? input_port_ : output_port_).push_back(port);
 }
 
 }  // namespace ocm
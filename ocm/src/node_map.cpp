@@ -1,23 +1,32 @@
 #include "node/node_map.hpp"
 
 namespace ocm {
-void NodeMap::AddNode(const std::string& node_name, std::shared_ptr<NodeBase> node_ptr) {
+NodeId NodeMap::AddNode(const std::string& node_name, std::shared_ptr<NodeBase> node_ptr) {
   // 检查节点名称是否已存在于节点映射中
-  if (node_map_.find(node_name) == node_map_.end()) {
-    // 将新节点添加到节点映射中
-    node_map_[node_name] = node_ptr;
-    // 记录节点添加的日志信息
-    logger_->info("[NodeMap] Node '{}' added!", node_name);
+  auto it = node_id_.find(node_name);
+  if (it != node_id_.end()) {
+    return it->second;
   }
+  // 将新节点添加到节点列表末尾，下标即为节点ID
+  NodeId id = static_cast<NodeId>(node_list_.size());
+  node_list_.push_back(std::move(node_ptr));
+  node_name_.push_back(node_name);
+  node_id_.emplace(node_name, id);
+  // 记录节点添加的日志信息
+  logger_->info("[NodeMap] Node '{}' added with id {}!", node_name, id);
+  return id;
 }
-const std::shared_ptr<NodeBase>& NodeMap::GetNodePtr(const std::string& key) const {
+NodeId NodeMap::GetNodeId(const std::string& node_name) const {
   // 在节点映射中查找指定的节点
-  auto it = node_map_.find(key);
+  auto it = node_id_.find(node_name);
   // 如果节点未找到，则抛出异常
-  if (it == node_map_.end()) {
-    throw std::runtime_error(std::format("[NodeMap] Node '{}' not found!", key));
+  if (it == node_id_.end()) {
+    throw std::runtime_error(std::format("[NodeMap] Node '{}' not found!", node_name));
   }
-  // 返回找到的节点指针
+  // 返回找到的节点ID
   return it->second;
 }
+const std::shared_ptr<NodeBase>& NodeMap::GetNodePtr(const std::string& key) const {
+  return node_list_[GetNodeId(key)];  // 先解析节点ID，再按ID检索
+}
 }  // namespace ocm
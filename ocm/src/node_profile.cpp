@@ -0,0 +1,23 @@
+#include "common/node_profile.hpp"
+
+namespace ocm {
+
+void NodeProfile::Reset() {
+  for (size_t i = 0; i < kNodePhaseNum; ++i) {
+    time[i].Reset();
+    worst_ns[i].store(0, std::memory_order_relaxed);
+    worst_time_ns[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+HistogramSummary NodeProfile::Summary(NodePhase phase) const { return time[static_cast<int>(phase)].Summary(); }
+
+NodeWorstCase NodeProfile::Worst(NodePhase phase) const {
+  int index = static_cast<int>(phase);
+  NodeWorstCase worst;
+  worst.duration_ns = worst_ns[index].load(std::memory_order_acquire);
+  worst.time_ns = worst_time_ns[index].load(std::memory_order_relaxed);
+  return worst;
+}
+
+}  // namespace ocm
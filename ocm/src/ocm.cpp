@@ -10,6 +10,7 @@
 #include <ctime>
 #include <stdexcept>
 #include "common/prefix_string.hpp"
+#include "monitor/trace.hpp"
 #include "ocm/shared_memory_semaphore.hpp"
 
 namespace ocm {
@@ -22,7 +23,8 @@ void SharedMemorySemaphore::Init(const std::string& name, unsigned int value) {
   if (sem_ == SEM_FAILED) {                                 // 检查信号量是否成功打开
     throw std::runtime_error("[SharedMemorySemaphore] Failed to initialize shared memory semaphore: " + std::string(strerror(errno)));  // 抛出异常
   } else {
-    name_ = sem_name;  // 保存信号量名称
+    name_ = sem_name;                                 // 保存信号量名称
+    trace_name_ = Trace::getInstance().Intern(name);  // 登记等待信号量的跟踪事件名称
   }
 }
 
@@ -53,6 +55,7 @@ void SharedMemorySemaphore::Increment(unsigned int value) {
 }
 
 void SharedMemorySemaphore::Decrement() {
+  TraceScope trace(TraceCategory::SEMAPHORE, trace_name_);
   if (sem_wait(sem_) != 0) {                                                                                             // 尝试减少信号量
     throw std::runtime_error("[SharedMemorySemaphore] Failed to decrement semaphore: " + std::string(strerror(errno)));  // 抛出异常
   }
@@ -73,7 +76,8 @@ bool SharedMemorySemaphore::DecrementTimeout(uint64_t milliseconds) {
   ts.tv_sec += ts.tv_nsec / 1000000000;           // 处理秒和纳秒的进位
   ts.tv_nsec %= 1000000000;                       // 确保纳秒在有效范围内
 
-  return (sem_timedwait(sem_, &ts) == 0);  // 尝试在超时内减少信号量
+  TraceScope trace(TraceCategory::SEMAPHORE, trace_name_);
+  return (sem_clockwait(sem_, CLOCK_MONOTONIC, &ts) == 0);  // 尝试在超时内减少信号量，截止时间基于单调时钟
 }
 
 int SharedMemorySemaphore::GetValue() const {
@@ -0,0 +1,34 @@
+#include "node/port.hpp"
+
+#include <stdexcept>
+#include "node/node.hpp"
+
+namespace ocm {
+
+PortBase::PortBase(NodeBase* node, const std::string& name, PortDirection direction, std::type_index type)
+    : name_(name), direction_(direction), type_(type) {
+  node->RegisterPort(this);  // 登记到所属节点
+}
+
+const std::string& PortBase::GetName() const { return name_; }
+
+PortDirection PortBase::GetDirection() const { return direction_; }
+
+std::type_index PortBase::GetType() const { return type_; }
+
+void PortBase::Connect(PortBase& output, PortBase& input) {
+  if (output.direction_ != PortDirection::OUTPUT || input.direction_ != PortDirection::INPUT) {
+    throw std::runtime_error("[Port] Port " + output.name_ + " must be an output and port " + input.name_ + " must be an input.");
+  }
+  if (output.type_ != input.type_) {
+    throw std::runtime_error("[Port] Port " + output.name_ + " and port " + input.name_ + " have different data types.");
+  }
+  if (input.connected_) {
+    throw std::runtime_error("[Port] Input port " + input.name_ + " is already connected.");
+  }
+  output.Attach(input);
+  output.connected_ = true;
+  input.connected_ = true;
+}
+
+}  // namespace ocm
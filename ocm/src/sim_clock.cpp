@@ -0,0 +1,137 @@
+#include "task/sim_clock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ocm {
+
+std::atomic_bool SimClock::enabled_{false};
+
+SimClock::SimClock() { now_ns_.store(0); }
+
+SimClock& SimClock::getInstance() {
+  static SimClock instance;
+  return instance;
+}
+
+int64_t SimClock::NowNs() const { return now_ns_.load(std::memory_order_acquire); }
+
+double SimClock::Now() const { return static_cast<double>(NowNs()) / 1e9; }
+
+double SimClock::Step(double dt) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  step_cv_.wait(lock, [this] { return !HasPending(); });  // 等待刚启动的任务就绪
+  now_ns_.store(now_ns_.load() + std::max<int64_t>(0, std::llround(dt * 1e9)), std::memory_order_release);
+  ReleaseDue(lock);
+  return Now();
+}
+
+double SimClock::StepToNext() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  step_cv_.wait(lock, [this] { return !HasPending(); });  // 等待刚启动的任务就绪
+  int64_t next_ns = std::numeric_limits<int64_t>::max();
+  for (auto* entry : entries_) {
+    if (entry->waiting) {
+      next_ns = std::min(next_ns, entry->next_release_ns);
+    }
+  }
+  if (next_ns == std::numeric_limits<int64_t>::max()) {
+    return Now();  // 没有等待中的任务
+  }
+  now_ns_.store(std::max(next_ns, now_ns_.load()), std::memory_order_release);
+  ReleaseDue(lock);
+  return Now();
+}
+
+void SimClock::Register(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.push_back(entry);
+  enabled_.store(true);  // 启用进程内的仿真时间
+}
+
+void SimClock::Unregister(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.erase(std::remove(entries_.begin(), entries_.end(), entry), entries_.end());
+  step_cv_.notify_all();
+}
+
+void SimClock::SetPeriod(SimClockEntry* entry, double period) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->period_ns = std::max<int64_t>(1, std::llround(period * 1e9));
+  entry->next_release_ns = NextAligned(entry);
+}
+
+void SimClock::SetPhase(SimClockEntry* entry, double phase) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->phase_ns = std::llround(phase * 1e9);
+  entry->next_release_ns = NextAligned(entry);
+}
+
+void SimClock::Activate(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!entry->waiting) {
+    entry->pending = true;  // 任务回到等待前不推进时间
+  }
+}
+
+void SimClock::Deactivate(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->pending = false;
+  entry->waiting = false;
+  step_cv_.notify_all();
+}
+
+void SimClock::Restart(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->next_release_ns = NextAligned(entry);
+  entry->consumed_seq = entry->release_seq;  // 丢弃待命期间的释放
+  entry->wake = false;
+}
+
+bool SimClock::Wait(SimClockEntry* entry) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  entry->pending = false;
+  entry->waiting = true;
+  step_cv_.notify_all();  // 通知控制者本任务已完成
+  task_cv_.wait(lock, [entry] { return entry->release_seq != entry->consumed_seq || entry->wake; });
+  entry->waiting = false;
+  if (entry->release_seq != entry->consumed_seq) {
+    entry->consumed_seq = entry->release_seq;
+    return true;
+  }
+  entry->wake = false;
+  return false;
+}
+
+void SimClock::Wake(SimClockEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->wake = true;
+  task_cv_.notify_all();
+}
+
+void SimClock::ReleaseDue(std::unique_lock<std::mutex>& lock) {
+  int64_t now_ns = now_ns_.load();
+  for (auto* entry : entries_) {
+    if (entry->waiting && entry->next_release_ns <= now_ns) {
+      entry->release_ns = entry->next_release_ns;
+      entry->next_release_ns += ((now_ns - entry->next_release_ns) / entry->period_ns + 1) * entry->period_ns;  // 一步内只运行一次
+      ++entry->release_seq;
+      entry->pending = true;
+    }
+  }
+  task_cv_.notify_all();
+  step_cv_.wait(lock, [this] { return !HasPending(); });  // 等待到期任务全部运行完成
+}
+
+int64_t SimClock::NextAligned(const SimClockEntry* entry) const {
+  int64_t now_ns = now_ns_.load();
+  int64_t offset = ((entry->phase_ns - now_ns) % entry->period_ns + entry->period_ns) % entry->period_ns;
+  return now_ns + (offset == 0 ? entry->period_ns : offset);
+}
+
+bool SimClock::HasPending() const {
+  return std::any_of(entries_.begin(), entries_.end(), [](const SimClockEntry* entry) { return entry->pending; });
+}
+
+}  // namespace ocm
@@ -0,0 +1,73 @@
+#include "common/state_notifier.hpp"
+
+#include <ctime>
+#include "common/futex.hpp"
+
+namespace ocm {
+
+StateNotifier::StateNotifier() {
+  seq_.store(0);
+  waiters_.store(0);
+}
+
+StateNotifier& StateNotifier::getInstance() {
+  static StateNotifier instance;
+  return instance;
+}
+
+void StateNotifier::Notify() {
+  seq_.fetch_add(1);
+  if (waiters_.load() > 0) {
+    FutexWake(&seq_);  // 仅在有等待者时进入内核
+  }
+}
+
+uint32_t StateNotifier::GetSeq() const { return seq_.load(); }
+
+bool StateNotifier::WaitChange(uint32_t seq, double timeout) {
+  timespec deadline;
+  const timespec* abs_timeout = nullptr;
+  if (timeout > 0) {
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    int64_t deadline_ns = static_cast<int64_t>(deadline.tv_sec) * 1000000000LL + deadline.tv_nsec + static_cast<int64_t>(timeout * 1e9);
+    deadline.tv_sec = static_cast<time_t>(deadline_ns / 1000000000LL);
+    deadline.tv_nsec = static_cast<long>(deadline_ns % 1000000000LL);
+    abs_timeout = &deadline;
+  }
+
+  waiters_.fetch_add(1);  // 先登记等待者再检查序号，保证通知者不会跳过唤醒
+  bool changed = true;
+  while (seq_.load() == seq) {
+    if (!FutexWait(&seq_, seq, abs_timeout)) {
+      changed = seq_.load() != seq;  // 超时
+      break;
+    }
+  }
+  waiters_.fetch_sub(1);
+  return changed;
+}
+
+bool StateNotifier::WaitFor(const std::function<bool()>& ready, double timeout) {
+  timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  while (true) {
+    uint32_t seq = seq_.load();
+    if (ready()) {
+      return true;
+    }
+    double remain = 0;
+    if (timeout > 0) {
+      timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      remain = timeout - (static_cast<double>(now.tv_sec - start.tv_sec) + static_cast<double>(now.tv_nsec - start.tv_nsec) / 1e9);
+      if (remain <= 0) {
+        return ready();
+      }
+    }
+    if (!WaitChange(seq, remain) && !ready()) {
+      return false;
+    }
+  }
+}
+
+}  // namespace ocm
@@ -2,56 +2,284 @@
 
 #include "task/task.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include "monitor/trace.hpp"
+
 namespace ocm {
 
+namespace {
+
+constexpr uint64_t kMaxNodeHyperPeriod = 4096; /**< 均衡分频节点负载时统计的最大超周期长度 */
+
+}  // namespace
+
 Task::Task(const TaskSetting& task_setting, const std::shared_ptr<std::vector<std::shared_ptr<NodeBase>>>& node_list, bool all_priority_enable,
            bool all_cpu_affinity_enable)
     : TaskBase(task_setting.task_name, task_setting.timer_setting.timer_type, static_cast<double>(task_setting.launch_setting.delay),
-               all_priority_enable, all_cpu_affinity_enable),
+               all_priority_enable, all_cpu_affinity_enable, task_setting.timer_setting.clock_name, task_setting.real_time),
       task_setting_(task_setting),
-      node_list_(node_list) {
-  SetPeriod(task_setting_.timer_setting.period);  // 根据配置设置任务的执行周期
+      node_list_(node_list),
+      all_priority_enable_(all_priority_enable),
+      all_cpu_affinity_enable_(all_cpu_affinity_enable),
+      profile_enable_(false),
+      tick_(0) {
+  SetPeriod(task_setting_.timer_setting.period);                 // 根据配置设置任务的执行周期
+  SetPhase(task_setting_.timer_setting.phase);                   // 根据配置设置任务的相位偏移
+  SetOverrunPolicy(task_setting_.timer_setting.overrun_policy);  // 根据配置设置任务的超限策略
+  if (task_setting_.timer_setting.spin_margin > 0) {
+    SetSpinMargin(task_setting_.timer_setting.spin_margin);  // 根据配置设置初始自旋余量
+  }
+  if (task_setting_.timer_setting.timer_type == TimerType::TOPIC_TRIGGER) {
+    // 根据配置绑定触发话题
+    SetTriggerTopics(task_setting_.timer_setting.trigger_topics, task_setting_.timer_setting.trigger_policy,
+                     task_setting_.timer_setting.trigger_timeout);
+  }
 
+  // 将节点列表编译为按下标访问的执行计划
+  std::unordered_map<std::string, const NodeConfig*> node_config;
+  for (const auto& node : task_setting_.node_list) {
+    node_config[node.node_name] = &node;
+  }
+  plan_ = std::make_unique<NodePlan[]>(node_list_->size());
+  for (size_t i = 0; i < node_list_->size(); ++i) {
+    const auto& node = (*node_list_)[i];
+    auto it = node_config.find(node->GetNodeName());
+    if (it == node_config.end()) {
+      throw std::runtime_error("[Task] Node " + node->GetNodeName() + " is not configured in task " + GetTaskName() + ".");
+    }
+    plan_[i].node = node.get();
+    plan_[i].output_enable = it->second->output_enable;  // 设置节点输出标志
+    plan_[i].init_request.store(false);                  // 初始化节点初始化请求为假
+    plan_[i].rate_divisor = 1;                           // 默认每个周期都运行
+    plan_[i].rate_phase.store(0);
+    plan_[i].auto_phase = false;
+    plan_[i].trace_execute = Trace::getInstance().Intern(node->GetNodeName());  // 登记节点执行与输出的跟踪事件名称
+    plan_[i].trace_output = Trace::getInstance().Intern(node->GetNodeName() + ".output");
+    node_index_[node->GetNodeName()] = i;
+  }
+  bool auto_phase = false;
   for (const auto& node : task_setting_.node_list) {
-    node_output_flag_[node.node_name] = node.output_enable;  // 设置节点输出标志
-    node_init_flag_[node.node_name] = false;                 // 初始化节点初始化标志为假
+    auto_phase |= ApplyNodeRate(node.node_name, node.rate_divisor, node.rate_phase);  // 根据配置设置节点分频
+  }
+  if (auto_phase) {
+    BalanceNodePhase();  // 所有节点的分频都设置后统一分配一次自动相位
+  }
+
+  if (task_setting_.profile_enable) {
+    SetProfileEnable(true);  // 根据配置启用节点耗时统计
+  }
+
+  if (task_setting_.parallel_enable) {
+    std::unordered_map<std::string, std::vector<std::string>> depend;
+    for (const auto& node : task_setting_.node_list) {
+      depend[node.node_name] = node.depend;  // 根据配置声明节点依赖
+    }
+    SetNodeDepend(depend);
   }
 }
 
+Task::~Task() {
+  graph_.reset();  // 先回收辅助线程，再释放节点
+}
+
 void Task::Init() {
-  for (auto& node : node_init_flag_) {
-    node.second = true;  // 将所有节点的初始化标志设置为真
+  for (size_t i = 0; i < node_list_->size(); ++i) {
+    plan_[i].init_request.store(true, std::memory_order_release);  // 请求所有节点在下一次运行时初始化
   }
 }
 
 std::set<std::string> Task::Init(const std::set<std::string>& init_node_list) {
   std::set<std::string> init_node_list_result;
-  for (auto& node : node_init_flag_) {
-    if (init_node_list.find(node.first) != init_node_list.end()) {
-      node.second = true;                        // 设置节点初始化标志为真
-      init_node_list_result.insert(node.first);  // 将成功初始化的节点名称添加到结果集中
+  for (const auto& node_name : init_node_list) {
+    auto it = node_index_.find(node_name);
+    if (it != node_index_.end()) {
+      plan_[it->second].init_request.store(true, std::memory_order_release);  // 请求节点在下一次运行时初始化
+      init_node_list_result.insert(node_name);                                // 将成功初始化的节点名称添加到结果集中
     }
   }
   return init_node_list_result;  // 返回成功初始化的节点名称集合
 }
 
+void Task::Init(const std::vector<size_t>& init_node_index) {
+  for (size_t index : init_node_index) {
+    plan_[index].init_request.store(true, std::memory_order_release);  // 请求节点在下一次运行时初始化
+  }
+}
+
 void Task::Run() {
-  for (auto& node : *node_list_) {
-    const auto& node_name = node->GetNodeName();
-    if (!node->GetIsConstruct()) {
-      node->Construct();           // 构造节点
-      node->SetIsConstruct(true);  // 设置节点构造标志
+  if (graph_) {
+    graph_->Run();  // 按依赖图并行运行节点
+  } else {
+    for (size_t i = 0, n = node_list_->size(); i < n; ++i) {
+      RunNode(i);  // 按配置顺序依次运行节点
     }
-    if (node_init_flag_.at(node_name)) {
-      node->Init();                           // 初始化节点
-      node_init_flag_.at(node_name) = false;  // 重置节点初始化标志
+  }
+  ++tick_;  // 所有节点运行结束后进入下一个周期
+}
+
+void Task::SetNodeDepend(const std::unordered_map<std::string, std::vector<std::string>>& depend) {
+  std::vector<std::vector<size_t>> depend_index(node_list_->size());
+  for (const auto& [node_name, depend_list] : depend) {
+    auto node_it = node_index_.find(node_name);
+    if (node_it == node_index_.end()) {
+      throw std::runtime_error("[Task] Node " + node_name + " does not belong to task " + GetTaskName() + ".");
+    }
+    for (const auto& depend_name : depend_list) {
+      auto depend_it = node_index_.find(depend_name);
+      if (depend_it == node_index_.end()) {
+        throw std::runtime_error("[Task] Node " + node_name + " depends on " + depend_name + ", which does not belong to task " + GetTaskName() +
+                                 ".");
+      }
+      depend_index[node_it->second].push_back(depend_it->second);
+    }
+  }
+
+  graph_.reset();  // 先回收旧的辅助线程
+  graph_ = std::make_unique<TaskGraph>(GetTaskName(), depend_index, [this](size_t index) { RunNode(index); }, task_setting_.system_setting,
+                                       all_priority_enable_, all_cpu_affinity_enable_);
+}
+
+void Task::RunNode(size_t index) {
+  NodePlan& plan = plan_[index];
+  if (plan.rate_divisor > 1 && tick_ % plan.rate_divisor != plan.rate_phase.load(std::memory_order_relaxed)) {
+    return;  // 本周期不是该节点的分频周期
+  }
+  NodeBase* node = plan.node;
+  node->LatchInputs();  // 锁存本周期的输入数据
+  NodeProfile* profile = profile_enable_.load(std::memory_order_relaxed) ? node->GetProfile() : nullptr;
+  int64_t start_ns = profile ? Monitor::NowNs() : 0;
+  // 记录阶段耗时，阶段结束时刻即为下一阶段的开始时刻
+  auto record = [&](NodePhase phase) {
+    if (profile) {
+      int64_t end_ns = Monitor::NowNs();
+      profile->Record(phase, start_ns, end_ns);
+      start_ns = end_ns;
     }
+  };
+  if (!node->GetIsConstruct() && node->ConstructOnce()) {  // 未预热的节点在首次运行时构造
+    record(NodePhase::CONSTRUCT);
+  }
+  // 先以普通读取判断，只有存在初始化请求时才执行读改写；在调用Init之前清除请求，Init期间到达的请求留到下一次运行
+  if (plan.init_request.load(std::memory_order_relaxed) && plan.init_request.exchange(false, std::memory_order_acquire)) {
+    node->Init();  // 初始化节点
+    record(NodePhase::INIT);
+  }
+  {
+    TraceScope trace(TraceCategory::NODE, plan.trace_execute);
     node->Execute();  // 执行节点
-    if (node_output_flag_[node_name]) {
+  }
+  record(NodePhase::EXECUTE);
+  if (plan.output_enable) {
+    {
+      TraceScope trace(TraceCategory::NODE, plan.trace_output);
       node->Output();  // 输出节点数据
     }
-    node->SetState(NodeState::RUNNING);  // 设置节点状态为运行中
+    record(NodePhase::OUTPUT);
+  }
+  node->PublishOutputs();              // 发布本周期写入的输出数据
+  node->SetState(NodeState::RUNNING);  // 设置节点状态为运行中
+}
+
+void Task::SetNodeRate(const std::string& node_name, int rate_divisor, int rate_phase) {
+  if (ApplyNodeRate(node_name, rate_divisor, rate_phase)) {
+    BalanceNodePhase();  // 为自动相位的节点分配相位
+  }
+}
+
+bool Task::ApplyNodeRate(const std::string& node_name, int rate_divisor, int rate_phase) {
+  auto it = node_index_.find(node_name);
+  if (it == node_index_.end()) {
+    throw std::runtime_error("[Task] Node " + node_name + " does not belong to task " + GetTaskName() + ".");
+  }
+  if (rate_divisor < 1 || rate_phase < -1 || rate_phase >= rate_divisor) {
+    throw std::runtime_error("[Task] Invalid rate divisor " + std::to_string(rate_divisor) + " or phase " + std::to_string(rate_phase) + " for node " +
+                             node_name + ".");
+  }
+  NodePlan& plan = plan_[it->second];
+  plan.rate_divisor = static_cast<uint32_t>(rate_divisor);
+  plan.auto_phase = rate_phase < 0;
+  plan.rate_phase.store(plan.auto_phase ? 0 : static_cast<uint32_t>(rate_phase));
+  return plan.auto_phase && rate_divisor > 1;
+}
+
+void Task::BalanceNodePhase() {
+  size_t node_num = node_list_->size();
+  uint64_t hyper_period = 1;
+  for (size_t i = 0; i < node_num; ++i) {
+    hyper_period = std::min(std::lcm(hyper_period, static_cast<uint64_t>(plan_[i].rate_divisor)), kMaxNodeHyperPeriod);  // 超周期过长时截断
+  }
+
+  // 所有节点都已有样本时以执行耗时p99作为负载，否则视每个节点的负载相同
+  std::vector<double> cost(node_num, 1.0);
+  bool measured = profile_enable_.load();
+  for (size_t i = 0; i < node_num && measured; ++i) {
+    NodeProfile* profile = plan_[i].node->GetProfile();
+    HistogramSummary summary = profile ? profile->Summary(NodePhase::EXECUTE) : HistogramSummary{};
+    measured = summary.count > 0;
+    cost[i] = static_cast<double>(summary.p99);
+  }
+  if (!measured) {
+    std::fill(cost.begin(), cost.end(), 1.0);
   }
+
+  // 先统计每周期运行与固定相位节点的负载
+  std::vector<double> load(hyper_period, 0.0);
+  std::vector<size_t> auto_list;
+  for (size_t i = 0; i < node_num; ++i) {
+    const NodePlan& plan = plan_[i];
+    if (plan.auto_phase && plan.rate_divisor > 1) {
+      auto_list.push_back(i);
+      continue;
+    }
+    for (uint64_t t = plan.rate_phase.load(); t < hyper_period; t += plan.rate_divisor) {
+      load[t] += cost[i];
+    }
+  }
+
+  // 耗时大的节点优先放置到峰值负载最小的相位
+  std::stable_sort(auto_list.begin(), auto_list.end(), [&cost](size_t lhs, size_t rhs) { return cost[lhs] > cost[rhs]; });
+  for (size_t i : auto_list) {
+    NodePlan& plan = plan_[i];
+    uint32_t best_phase = 0;
+    double best_peak = std::numeric_limits<double>::max();
+    double best_sum = std::numeric_limits<double>::max();
+    for (uint32_t phase = 0; phase < plan.rate_divisor; ++phase) {
+      double peak = 0.0, sum = 0.0;
+      for (uint64_t t = phase; t < hyper_period; t += plan.rate_divisor) {
+        peak = std::max(peak, load[t]);
+        sum += load[t];
+      }
+      if (peak < best_peak || (peak == best_peak && sum < best_sum)) {
+        best_phase = phase;
+        best_peak = peak;
+        best_sum = sum;
+      }
+    }
+    for (uint64_t t = best_phase; t < hyper_period; t += plan.rate_divisor) {
+      load[t] += cost[i];
+    }
+    if (plan.rate_phase.exchange(best_phase, std::memory_order_relaxed) == best_phase) {
+      continue;  // 相位未变化时不记录日志
+    }
+    GetLogger()->info("[Task] Node {} in task {} runs every {} ticks at phase {}.", plan.node->GetNodeName(), GetTaskName(), plan.rate_divisor, best_phase);
+  }
+}
+
+void Task::SetProfileEnable(bool profile_enable) {
+  if (profile_enable) {
+    for (const auto& node : *node_list_) {
+      node->EnableProfile(GetTaskName());  // 首次启用时登记节点耗时统计
+    }
+  }
+  profile_enable_.store(profile_enable);
+}
+
+const NodeProfile* Task::GetNodeProfile(const std::string& node_name) const {
+  auto it = node_index_.find(node_name);
+  return it != node_index_.end() ? plan_[it->second].node->GetProfile() : nullptr;
 }
 
 const TaskSetting& Task::GetTaskSetting() const { return task_setting_; }  // 返回任务的配置设置
@@ -1,19 +1,29 @@
 
 #include "task/task_base.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include "common/futex.hpp"
+#include "common/state_notifier.hpp"
+#include "monitor/trace.hpp"
 #include "task/rt/sched_rt.hpp"
 #include "task/timer.hpp"
 
 namespace ocm {
 
-SleepInternalTimer::SleepInternalTimer() {
+SleepInternalTimer::SleepInternalTimer() : yield_on_complete_(false) {
   SetPeriod(0.01);  // 使用默认的0.01秒周期初始化内部计时器
 }
 
 void SleepInternalTimer::Sleep(double duration) {
-  timer_loop_.SleepUntilNextLoop();  // 调用内部 TimerLoop 实例的 SleepUntilNextLoop
-  if (duration > GetPeriod()) {
-    timer_loop_.ResetClock();  // 如果指定的持续时间超过当前周期，则重置定时器时钟
+  if (yield_on_complete_) {
+    sched_yield();  // 作业结束，放弃本周期剩余的截止时间调度预算
   }
+  timer_loop_.SleepUntilNextLoop();  // 调用内部 TimerLoop 实例的 SleepUntilNextLoop，超限由其按策略处理
 }
 
 void SleepInternalTimer::SetPeriod(double period) {
@@ -24,41 +34,172 @@ double SleepInternalTimer::GetPeriod() const {
   return timer_loop_.GetPeriod();  // 从内部的 TimerLoop 实例中获取周期
 }
 
+void SleepInternalTimer::SetPhase(double phase) { timer_loop_.SetPhase(phase); }
+
 void SleepInternalTimer::Continue() {
   timer_loop_.ResetClock();  // 调用内部 TimerLoop 实例的 ResetClock
 }
 
-SleepExternalTimer::SleepExternalTimer(const std::string& sem_name, const std::string& shm_name)
-    : sem_(sem_name, 0), shm_(shm_name, false, sizeof(uint8_t)) {
-  shm_.Lock();               // 锁定共享内存
-  dt_ = *shm_.Get();         // 从共享内存中读取初始定时器增量
-  shm_.UnLock();             // 解锁共享内存
-  interval_count_.store(0);  // 初始化间隔计数
+void SleepInternalTimer::SetOverrunPolicy(OverrunPolicy policy) { timer_loop_.SetOverrunPolicy(policy); }
+
+void SleepInternalTimer::SetMissCallback(DeadlineMissCallback callback) { timer_loop_.SetMissCallback(std::move(callback)); }
+
+uint64_t SleepInternalTimer::GetMissCount() const { return timer_loop_.GetMissCount(); }
+
+void SleepInternalTimer::Restart() { timer_loop_.Restart(); }
+
+int64_t SleepInternalTimer::GetReleaseNs() const { return timer_loop_.GetReleaseNs(); }
+
+void SleepInternalTimer::SetYieldOnComplete(bool enable) { yield_on_complete_ = enable; }
+
+SleepHybridSpin::SleepHybridSpin() {
+  timer_loop_.SetHybridSpin(true);  // 启用先睡眠后自旋
+}
+
+void SleepHybridSpin::SetSpinMargin(double margin, bool auto_calibrate) { timer_loop_.SetSpinMargin(margin, auto_calibrate); }
+
+double SleepHybridSpin::GetSpinMargin() const { return timer_loop_.GetSpinMargin(); }
+
+SleepExternalTimer::SleepExternalTimer(const std::string& clock_name)
+    : period_(0.001),
+      tick_period_ns_(0),
+      period_ticks_(1),
+      phase_ticks_(0),
+      next_tick_(0),
+      release_tick_(0),
+      miss_reported_tick_(0),
+      started_(false),
+      released_(false),
+      overrun_policy_(OverrunPolicy::CATCH_UP) {
+  shm_ = std::make_unique<SharedMemoryData<ExternalClockSegment>>(clock_name, true, sizeof(ExternalClockSegment));  // 映射外部时钟段
+  segment_ = shm_->Get();
+  phase_.store(0.0);
+  phase_changed_.store(false);
+  continue_.store(false);
+  miss_count_.store(0);
 }
 
 void SleepExternalTimer::Sleep(double duration) {
-  while (interval_count_ < interval_time_ && duration < GetPeriod()) {
-    sem_.Decrement();              // 等待信号量并递减
-    interval_count_.fetch_add(1);  // 增加间隔计数
+  if (!UpdatePeriodTicks() || !started_) {
+    // 时钟源尚未启动或需要重新计时，以当前节拍为起点
+    if (!WaitFor([this] { return UpdatePeriodTicks(); })) {
+      return;
+    }
+    uint64_t tick = segment_->tick.load(std::memory_order_acquire) + 1;
+    next_tick_ = tick + (phase_ticks_ + period_ticks_ - tick % period_ticks_) % period_ticks_;  // 当前节拍之后最近的相位网格点
+    miss_reported_tick_ = 0;                                                                   // 时钟源可能已重新从0计数
+    started_ = true;
+  } else {
+    uint64_t tick = segment_->tick.load(std::memory_order_acquire);
+    if (tick >= next_tick_) {
+      // 运行结束时已到达下一个释放节拍，即错过了本周期的截止时间
+      uint64_t missed = (tick - next_tick_) / period_ticks_ + 1;
+      uint64_t last_missed_tick = next_tick_ + (missed - 1) * period_ticks_;
+      if (last_missed_tick > miss_reported_tick_) {
+        // 追赶运行时已上报过的释放不再重复计数，只上报其后新错过的释放
+        uint64_t new_missed = next_tick_ > miss_reported_tick_ ? missed : (last_missed_tick - miss_reported_tick_) / period_ticks_;
+        miss_reported_tick_ = last_missed_tick;
+        miss_count_.fetch_add(1);
+        if (miss_callback_ && new_missed > 0) {
+          miss_callback_(new_missed);
+        }
+      }
+      if (overrun_policy_ == OverrunPolicy::CATCH_UP) {
+        release_tick_ = next_tick_;  // 立即运行，并只前进一个周期
+        released_ = true;
+        next_tick_ += period_ticks_;
+        return;
+      } else if (overrun_policy_ == OverrunPolicy::SKIP) {
+        next_tick_ += missed * period_ticks_;  // 跳过已错过的周期，对齐到下一个周期网格点
+      } else {
+        next_tick_ = tick + period_ticks_;  // 以当前节拍为起点重新计时
+      }
+    }
   }
-  interval_count_.store(0);  // 重置间隔计数
+
+  if (!WaitFor([this] { return segment_->tick.load(std::memory_order_acquire) >= next_tick_; })) {
+    return;
+  }
+  release_tick_ = next_tick_;  // 记录本次释放节拍
+  released_ = true;
+  next_tick_ += period_ticks_;  // 安排下一个释放节拍
 }
 
 void SleepExternalTimer::SetPeriod(double period) {
-  if (dt_ < 1) {
-    dt_ = 1;  // 确保定时器增量至少为1毫秒
-  }
-  interval_time_.store(static_cast<int>(period * 1000 / dt_));  // 根据周期和定时器增量计算所需的间隔数
-  interval_count_.store(0);                                     // 重置间隔计数
+  period_ = period;
+  tick_period_ns_ = 0;  // 下一次睡眠时按节拍周期重新取整
+  started_ = false;
+}
+
+void SleepExternalTimer::SetPhase(double phase) {
+  phase_.store(phase);
+  phase_changed_.store(true, std::memory_order_release);  // 由任务线程在下一次睡眠时重新对齐
 }
 
 double SleepExternalTimer::GetPeriod() const {
-  return static_cast<double>(interval_time_ * dt_);  // 通过将间隔时间乘以定时器增量来计算周期
+  if (tick_period_ns_ == 0) {
+    return period_ * 1000.0;  // 时钟源尚未启动，返回期望周期
+  }
+  return static_cast<double>(period_ticks_ * tick_period_ns_) / 1e6;
 }
 
 void SleepExternalTimer::Continue() {
-  interval_time_.store(0);  // 将间隔时间设置为零
-  sem_.Increment();         // 增加信号量以释放任何等待的线程
+  continue_.store(true);
+  segment_->seq.fetch_add(1);
+  FutexWake(&segment_->seq, INT_MAX, true);  // 唤醒睡眠中的线程，同一时钟段的其它订阅者会重新检查条件后继续等待
+}
+
+void SleepExternalTimer::SetOverrunPolicy(OverrunPolicy policy) { overrun_policy_ = policy; }
+
+void SleepExternalTimer::SetMissCallback(DeadlineMissCallback callback) { miss_callback_ = std::move(callback); }
+
+uint64_t SleepExternalTimer::GetMissCount() const { return miss_count_.load(); }
+
+void SleepExternalTimer::Restart() {
+  continue_.store(false);  // 丢弃待命期间的唤醒请求
+  started_ = false;        // 下一次睡眠时以当前节拍为起点
+}
+
+int64_t SleepExternalTimer::GetReleaseNs() const {
+  if (!released_) {
+    return 0;
+  }
+  uint64_t tick_period_ns = segment_->tick_period_ns.load(std::memory_order_relaxed);
+  return segment_->epoch_ns.load(std::memory_order_relaxed) + static_cast<int64_t>(release_tick_ * tick_period_ns);
+}
+
+bool SleepExternalTimer::UpdatePeriodTicks() {
+  if (segment_->magic.load(std::memory_order_acquire) != kExternalClockMagic) {
+    return false;
+  }
+  uint64_t tick_period_ns = segment_->tick_period_ns.load(std::memory_order_relaxed);
+  if (tick_period_ns == 0) {
+    return false;
+  }
+  bool phase_changed = phase_changed_.exchange(false, std::memory_order_acquire);
+  if (tick_period_ns != tick_period_ns_ || phase_changed) {
+    tick_period_ns_ = tick_period_ns;
+    period_ticks_ = std::max<uint64_t>(1, std::llround(period_ * 1e9 / static_cast<double>(tick_period_ns_)));  // 周期按节拍四舍五入
+    long long phase_ticks = std::llround(phase_.load() * 1e9 / static_cast<double>(tick_period_ns_));  // 相位按节拍四舍五入
+    phase_ticks_ = static_cast<uint64_t>(std::max<long long>(0, phase_ticks)) % period_ticks_;
+    started_ = false;  // 节拍周期或相位改变，重新计时
+  }
+  return true;
+}
+
+bool SleepExternalTimer::WaitFor(const std::function<bool()>& ready) {
+  while (true) {
+    uint32_t seq = segment_->seq.load(std::memory_order_acquire);
+    if (continue_.exchange(false)) {
+      return false;
+    }
+    if (ready()) {
+      return true;
+    }
+    segment_->waiters.fetch_add(1);
+    FutexWait(&segment_->seq, seq, nullptr, true);  // 等待时钟源发布新的节拍
+    segment_->waiters.fetch_sub(1);
+  }
 }
 
 SleepTrigger::SleepTrigger(const std::string& sem_name) : sem_(sem_name, 0) {}
@@ -71,31 +212,362 @@ void SleepTrigger::Continue() {
   sem_.Increment();  // 增加信号量，释放任何等待的线程
 }
 
-TaskBase::TaskBase(const std::string& thread_name, TimerType type, double sleep_duration, bool all_priority_enable, bool all_cpu_affinity_enable)
-    : start_sem_(0), sleep_duration_(sleep_duration), all_priority_enable_(all_priority_enable), all_cpu_affinity_enable_(all_cpu_affinity_enable) {
+SleepTopicTrigger::SleepTopicTrigger()
+    : segment_(TopicSignal::getInstance().GetSegment()),
+      epoch_mask_(FUTEX_BITSET_MATCH_ANY),
+      policy_(TriggerPolicy::ANY_OF),
+      timeout_ns_(0),
+      timeout_miss_(true),
+      timeout_aligned_(false),
+      release_ns_(0) {
+  if (!segment_) {
+    throw std::runtime_error("[SleepTopicTrigger] Topic signal shared memory is unavailable.");
+  }
+  continue_.store(false);
+  miss_count_.store(0);
+  phase_ns_.store(0);
+}
+
+void SleepTopicTrigger::Sleep(double duration) {
+  int64_t deadline_ns = 0;
+  if (timeout_ns_ > 0) {
+    int64_t now_ns = Monitor::NowNs();
+    deadline_ns = now_ns + timeout_ns_;
+    if (timeout_aligned_) {
+      int64_t offset = ((phase_ns_.load() - now_ns) % timeout_ns_ + timeout_ns_) % timeout_ns_;
+      deadline_ns = now_ns + (offset > 0 ? offset : timeout_ns_);  // 严格晚于当前时间的下一个网格点
+    }
+  }
+  timespec deadline;
+  deadline.tv_sec = static_cast<time_t>(deadline_ns / 1000000000LL);
+  deadline.tv_nsec = static_cast<long>(deadline_ns % 1000000000LL);
+  bool wait_epoch = slots_.size() != 1 && policy_ == TriggerPolicy::ANY_OF;  // 任意多个话题之一无法在单个话题上等待
+
+  while (true) {
+    // 先读取futex字再检查条件，保证检查之后的发布一定能让等待立即返回
+    std::atomic<uint32_t>* word = &segment_->epoch;
+    std::atomic<uint32_t>* waiters = nullptr;
+    uint32_t expected = segment_->epoch.load(std::memory_order_acquire);
+    if (continue_.exchange(false)) {
+      return;
+    }
+    size_t fresh = 0;
+    for (size_t i = 0; i < slots_.size(); ++i) {
+      uint32_t wake = slots_[i]->wake.load(std::memory_order_acquire);
+      if (slots_[i]->seq.load(std::memory_order_acquire) != seen_seq_[i]) {
+        ++fresh;
+      } else if (!wait_epoch && word == &segment_->epoch) {
+        word = &slots_[i]->wake;  // 在第一个尚无新数据的话题上等待
+        waiters = &slots_[i]->waiters;
+        expected = wake;
+      }
+    }
+
+    if (!slots_.empty() && (policy_ == TriggerPolicy::ANY_OF ? fresh > 0 : fresh == slots_.size())) {
+      // 消费新数据，唤醒时间取触发本次唤醒的发布时间
+      release_ns_ = policy_ == TriggerPolicy::ANY_OF ? INT64_MAX : 0;
+      for (size_t i = 0; i < slots_.size(); ++i) {
+        uint32_t seq = slots_[i]->seq.load(std::memory_order_acquire);
+        if (seq == seen_seq_[i]) {
+          continue;
+        }
+        seen_seq_[i] = seq;
+        int64_t publish_ns = slots_[i]->publish_ns.load(std::memory_order_relaxed);
+        release_ns_ = policy_ == TriggerPolicy::ANY_OF ? std::min(release_ns_, publish_ns) : std::max(release_ns_, publish_ns);
+      }
+      return;
+    }
+
+    if (deadline_ns > 0 && Monitor::NowNs() >= deadline_ns) {
+      // 超时未触发，照常唤醒任务，需要时计为一次错过截止时间
+      release_ns_ = deadline_ns;
+      if (timeout_miss_) {
+        miss_count_.fetch_add(1);
+        if (miss_callback_) {
+          miss_callback_(1);
+        }
+      }
+      return;
+    }
+
+    if (waiters) {
+      waiters->fetch_add(1);
+      FutexWait(word, expected, deadline_ns > 0 ? &deadline : nullptr, true);  // 等待话题发布或超时
+      waiters->fetch_sub(1);
+    } else {
+      // 在epoch上只等待所绑定话题的位，其它话题的发布不会唤醒本线程
+      for (auto* slot : slots_) {
+        slot->epoch_waiters.fetch_add(1);
+      }
+      FutexWait(word, expected, deadline_ns > 0 ? &deadline : nullptr, true, epoch_mask_);
+      for (auto* slot : slots_) {
+        slot->epoch_waiters.fetch_sub(1);
+      }
+    }
+  }
+}
+
+void SleepTopicTrigger::SetTriggerTopics(const std::vector<std::string>& topics, TriggerPolicy policy, double timeout, bool timeout_miss,
+                                         bool timeout_aligned) {
+  if (topics.empty()) {
+    throw std::runtime_error("[SleepTopicTrigger] Trigger topic list is empty.");
+  }
+  std::vector<TopicSignalSlot*> slots;
+  uint32_t epoch_mask = 0;
+  for (const auto& topic : topics) {
+    TopicSignalSlot* slot = TopicSignal::getInstance().GetSlot(topic);
+    if (!slot) {
+      throw std::runtime_error("[SleepTopicTrigger] No topic signal slot for topic " + topic + ".");
+    }
+    slots.push_back(slot);
+    epoch_mask |= TopicSignalBit(segment_, slot);
+  }
+  slots_ = std::move(slots);
+  epoch_mask_ = epoch_mask;
+  seen_seq_.resize(slots_.size());
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    seen_seq_[i] = slots_[i]->seq.load(std::memory_order_acquire);  // 只等待绑定之后的发布
+  }
+  policy_ = policy;
+  timeout_ns_ = timeout > 0 ? std::llround(timeout * 1e9) : 0;
+  timeout_miss_ = timeout_miss;
+  timeout_aligned_ = timeout_aligned;
+}
+
+void SleepTopicTrigger::SetPhase(double phase) { phase_ns_.store(std::llround(phase * 1e9)); }
+
+void SleepTopicTrigger::Continue() {
+  continue_.store(true);
+  for (auto* slot : slots_) {
+    slot->wake.fetch_add(1);
+    FutexWake(&slot->wake, INT_MAX, true);  // 同一话题的其它订阅者会重新检查发布序号后继续等待
+  }
+  segment_->epoch.fetch_add(1);
+  FutexWake(&segment_->epoch, INT_MAX, true, epoch_mask_);  // 只唤醒与本任务绑定话题位相同的订阅者
+}
+
+void SleepTopicTrigger::SetMissCallback(DeadlineMissCallback callback) { miss_callback_ = std::move(callback); }
+
+uint64_t SleepTopicTrigger::GetMissCount() const { return miss_count_.load(); }
+
+void SleepTopicTrigger::Restart() {
+  continue_.store(false);  // 丢弃待命期间的唤醒请求
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    seen_seq_[i] = slots_[i]->seq.load(std::memory_order_acquire);  // 丢弃待命期间的发布
+  }
+}
+
+int64_t SleepTopicTrigger::GetReleaseNs() const { return release_ns_; }
+
+SleepTimerService::SleepTimerService() : last_seq_(0), miss_reported_seq_(0), overrun_policy_(OverrunPolicy::CATCH_UP) {
+  miss_count_.store(0);
+  period_.store(0.01);
+  phase_.store(0.0);
+  timing_changed_.store(false);
+  TimerService::getInstance().Add(&entry_, period_.load(), phase_.load());  // 使用默认的0.01秒周期加入时间轮
+}
+
+SleepTimerService::~SleepTimerService() {
+  TimerService::getInstance().Remove(&entry_);  // 将定时器移出时间轮
+}
+
+void SleepTimerService::Sleep(double duration) {
+  if (timing_changed_.exchange(false, std::memory_order_acquire)) {
+    TimerService::getInstance().Add(&entry_, period_.load(), phase_.load());  // 按新周期与相位重新调度
+    last_seq_ = entry_.seq.load(std::memory_order_acquire);                  // 丢弃按旧周期与相位产生的到期
+    miss_reported_seq_ = last_seq_;
+  }
+
+  uint32_t seq = entry_.seq.load(std::memory_order_acquire);
+  uint32_t pending = seq - last_seq_;
+  if (pending > 0) {
+    // 运行期间定时器已再次到期，即错过了本周期的截止时间；追赶运行时已上报过的到期不再重复计数
+    uint32_t reported = static_cast<int32_t>(miss_reported_seq_ - last_seq_) > 0 ? miss_reported_seq_ : last_seq_;
+    uint32_t missed = seq - reported;
+    if (static_cast<int32_t>(missed) > 0) {
+      miss_reported_seq_ = seq;
+      miss_count_.fetch_add(1);
+      if (miss_callback_) {
+        miss_callback_(missed);
+      }
+    }
+    if (overrun_policy_ == OverrunPolicy::CATCH_UP) {
+      ++last_seq_;  // 立即运行，逐个消费积压的到期
+      return;
+    } else if (overrun_policy_ == OverrunPolicy::RESTART) {
+      TimerService::getInstance().Restart(&entry_);  // 以当前节拍为起点重新计时
+      seq = entry_.seq.load(std::memory_order_acquire);
+    }
+    last_seq_ = seq;  // 丢弃积压的到期，等待下一个到期节拍
+  }
+
+  while (seq == last_seq_) {
+    FutexWait(&entry_.seq, seq);  // 等待时钟线程唤醒
+    seq = entry_.seq.load(std::memory_order_acquire);
+  }
+  ++last_seq_;  // 消费一次到期
+}
+
+void SleepTimerService::SetPeriod(double period) {
+  period_.store(period);
+  timing_changed_.store(true, std::memory_order_release);  // 由任务线程在下一次睡眠时重新调度
+}
+
+double SleepTimerService::GetPeriod() const {
+  return period_.load() * 1000.0;  // 与内部定时器一致，以毫秒返回
+}
+
+void SleepTimerService::SetPhase(double phase) {
+  phase_.store(phase);
+  timing_changed_.store(true, std::memory_order_release);  // 由任务线程在下一次睡眠时重新调度
+}
+
+void SleepTimerService::Continue() {
+  entry_.seq.fetch_add(1, std::memory_order_release);
+  FutexWake(&entry_.seq);  // 唤醒睡眠中的线程
+}
+
+void SleepTimerService::SetOverrunPolicy(OverrunPolicy policy) { overrun_policy_ = policy; }
+
+void SleepTimerService::SetMissCallback(DeadlineMissCallback callback) { miss_callback_ = std::move(callback); }
+
+uint64_t SleepTimerService::GetMissCount() const { return miss_count_.load(); }
+
+void SleepTimerService::Restart() {
+  last_seq_ = entry_.seq.load(std::memory_order_acquire);  // 丢弃待命期间累积的到期
+}
+
+int64_t SleepTimerService::GetReleaseNs() const { return entry_.release_ns.load(std::memory_order_relaxed); }
+
+SleepSimulated::SleepSimulated() : period_(0.01) {
+  SimClock::getInstance().Register(&entry_);  // 登记到仿真时钟，使用默认的0.01秒周期
+}
+
+SleepSimulated::~SleepSimulated() {
+  SimClock::getInstance().Unregister(&entry_);  // 从仿真时钟注销
+}
+
+void SleepSimulated::Sleep(double duration) {
+  SimClock::getInstance().Wait(&entry_);  // 等待控制者推进仿真时间
+}
+
+void SleepSimulated::SetPeriod(double period) {
+  period_ = period;
+  SimClock::getInstance().SetPeriod(&entry_, period_);
+}
+
+double SleepSimulated::GetPeriod() const {
+  return period_ * 1000.0;  // 与内部定时器一致，以毫秒返回
+}
+
+void SleepSimulated::SetPhase(double phase) { SimClock::getInstance().SetPhase(&entry_, phase); }
+
+void SleepSimulated::Continue() { SimClock::getInstance().Wake(&entry_); }
+
+void SleepSimulated::Restart() { SimClock::getInstance().Restart(&entry_); }
+
+void SleepSimulated::Activate() { SimClock::getInstance().Activate(&entry_); }
+
+void SleepSimulated::Deactivate() { SimClock::getInstance().Deactivate(&entry_); }
+
+SleepWorkerPool::SleepWorkerPool(std::function<void()> run, double start_delay) : period_(0.01), phase_(0.0) {
+  job_.run = std::move(run);
+  job_.start_delay_ns = std::llround(start_delay * 1e9);
+  WorkerPool::getInstance().Add(&job_);  // 登记到工作线程池，使用默认的0.01秒周期
+}
+
+SleepWorkerPool::~SleepWorkerPool() {
+  WorkerPool::getInstance().Remove(&job_);  // 注销作业
+}
+
+void SleepWorkerPool::SetPeriod(double period) {
+  period_ = period;
+  WorkerPool::getInstance().SetTiming(&job_, period_, phase_);
+}
+
+double SleepWorkerPool::GetPeriod() const {
+  return period_ * 1000.0;  // 与内部定时器一致，以毫秒返回
+}
+
+void SleepWorkerPool::SetPhase(double phase) {
+  phase_ = phase;
+  WorkerPool::getInstance().SetTiming(&job_, period_, phase_);
+}
+
+void SleepWorkerPool::SetOverrunPolicy(OverrunPolicy policy) { job_.overrun_policy = policy; }
+
+void SleepWorkerPool::SetMissCallback(DeadlineMissCallback callback) { job_.miss_callback = std::move(callback); }
+
+uint64_t SleepWorkerPool::GetMissCount() const { return job_.miss_count.load(); }
+
+int64_t SleepWorkerPool::GetReleaseNs() const { return job_.release_ns.load(std::memory_order_relaxed); }
+
+void SleepWorkerPool::Activate() { WorkerPool::getInstance().Activate(&job_); }
+
+void SleepWorkerPool::Deactivate() { WorkerPool::getInstance().Deactivate(&job_); }
+
+TaskBase::TaskBase(const std::string& thread_name, TimerType type, double sleep_duration, bool all_priority_enable, bool all_cpu_affinity_enable,
+                   const std::string& clock_name, bool real_time)
+    : start_sem_(0), pooled_(false), sleep_duration_(sleep_duration), all_priority_enable_(all_priority_enable),
+      all_cpu_affinity_enable_(all_cpu_affinity_enable), deadline_active_(false) {
   logger_ = GetLogger();  // 获取日志记录器
 
-  if (type == TimerType::INTERNAL_TIMER) {
+  if (!real_time) {
+    if (type == TimerType::INTERNAL_TIMER || type == TimerType::HYBRID_SPIN || type == TimerType::TIMER_SERVICE) {
+      pooled_ = true;
+    } else {
+      logger_->warn("[TASK] {} task is not time driven and keeps a dedicated thread.", thread_name);  // 外部时钟、触发与仿真任务无法由线程池调度
+    }
+  }
+
+  if (pooled_) {
+    timer_ = std::make_unique<SleepWorkerPool>([this] { RunOnce(); }, sleep_duration_ * 1e-3);  // 与独立线程的初始休眠一致
+  } else if (type == TimerType::INTERNAL_TIMER) {
     timer_ = std::make_unique<SleepInternalTimer>();  // 根据定时器类型初始化适当的休眠机制
   } else if (type == TimerType::EXTERNAL_TIMER) {
-    timer_ = std::make_unique<SleepExternalTimer>(thread_name, thread_name);
+    timer_ = std::make_unique<SleepExternalTimer>(clock_name.empty() ? thread_name : clock_name);
   } else if (type == TimerType::TRIGGER) {
     timer_ = std::make_unique<SleepTrigger>(thread_name);
+  } else if (type == TimerType::TIMER_SERVICE) {
+    timer_ = std::make_unique<SleepTimerService>();
+  } else if (type == TimerType::HYBRID_SPIN) {
+    timer_ = std::make_unique<SleepHybridSpin>();
+  } else if (type == TimerType::SIMULATED) {
+    timer_ = std::make_unique<SleepSimulated>();
+  } else if (type == TimerType::TOPIC_TRIGGER) {
+    timer_ = std::make_unique<SleepTopicTrigger>();
   }
 
-  thread_name_ = thread_name;     // 设置线程名称
-  TaskCreate();                   // 创建任务线程
-  run_duration_.store(0.0);       // 初始化运行持续时间
-  loop_duration_.store(0.0);      // 初始化循环持续时间
-  run_flag_.store(false);         // 初始化运行标志
-  loop_run_.store(false);         // 初始化循环运行标志
-  state_.store(TaskState::INIT);  // 初始化任务状态
+  thread_name_ = thread_name;                                        // 设置线程名称
+  trace_name_ = Trace::getInstance().Intern(thread_name);            // 登记跟踪事件名称
+  monitor_slot_ = Monitor::getInstance().RegisterTask(thread_name);  // 登记任务监控槽位
+  if (monitor_slot_) {
+    wake_latency_hist_ = &monitor_slot_->wake_latency;  // 直方图直接写入共享内存
+    run_time_hist_ = &monitor_slot_->run_time;
+  } else {
+    local_hist_ = std::make_unique<LatencyHistogram[]>(2);
+    wake_latency_hist_ = &local_hist_[0];
+    run_time_hist_ = &local_hist_[1];
+  }
+  ResetTimingStats();                                             // 初始化统计
+  run_duration_.store(0.0);                                       // 初始化运行持续时间
+  loop_duration_.store(0.0);                                      // 初始化循环持续时间
+  run_flag_.store(false);                                         // 初始化运行标志
+  loop_run_.store(false);                                         // 初始化循环运行标志
+  state_.store(pooled_ ? TaskState::STANDBY : TaskState::INIT);  // 初始化任务状态，非实时任务没有线程，直接待命
+  TaskCreate();                                                   // 创建任务线程
 }
 
-TaskBase::~TaskBase() = default;
+TaskBase::~TaskBase() {
+  Monitor::getInstance().UnregisterTask(monitor_slot_);  // 释放任务监控槽位
+}
 
 void TaskBase::TaskCreate() {
-  thread_alive_.store(true);                                               // 设置线程存活标志
+  thread_alive_.store(true);  // 设置线程存活标志
+  if (pooled_) {
+    logger_->info("[TASK] {} task has been added to the worker pool!", thread_name_);  // 记录任务作业登记信息
+    return;
+  }
   thread_ = std::thread([this] { Loop(); });                               // 创建任务线程
   logger_->info("[TASK] {} task thread has been created!", thread_name_);  // 记录任务线程创建信息
 }
@@ -104,7 +576,10 @@ void TaskBase::TaskStart(const SystemSetting& system_setting) {
   system_setting_start_ = system_setting;                              // 设置启动系统设置
   run_flag_.store(true);                                               // 设置运行标志为真
   loop_run_.store(true);                                               // 设置循环运行标志为真
-  start_sem_.release();                                                // 释放启动信号量
+  timer_->Activate();                                                  // 通知睡眠机制任务即将启动
+  if (!pooled_) {
+    start_sem_.release();  // 释放启动信号量
+  }
   logger_->info("[TASK] {} task thread ready to run!", thread_name_);  // 记录任务启动信息
 }
 
@@ -112,13 +587,24 @@ void TaskBase::TaskStop(const SystemSetting& system_setting) {
   system_setting_stop_ = system_setting;                                // 设置停止系统设置
   run_flag_.store(false);                                               // 设置运行标志为假
   loop_run_.store(false);                                               // 设置循环运行标志为假
-  timer_->Continue();                                                   // 信号定时器继续
+  if (pooled_) {
+    timer_->Deactivate();          // 停止调度作业，等待正在运行的作业结束
+    SetState(TaskState::STANDBY);  // 设置任务状态为待命
+  } else {
+    timer_->Continue();  // 信号定时器继续
+  }
   logger_->info("[TASK] {} task thread ready to stop!", thread_name_);  // 记录任务停止信息
 }
 
 void TaskBase::TaskDestroy() {
   thread_alive_.store(false);  // 设置线程存活标志为假
   loop_run_.store(false);      // 设置循环运行标志为假
+  if (pooled_) {
+    timer_->Deactivate();  // 停止调度作业，等待正在运行的作业结束
+    SetState(TaskState::STANDBY);
+    logger_->info("[TASK] {} task has been removed from the worker pool!", thread_name_);  // 记录任务作业停止信息
+    return;
+  }
   run_flag_.store(true);       // 设置运行标志为真
   start_sem_.release();        // 释放启动信号量
   timer_->Continue();          // 信号定时器继续
@@ -133,29 +619,49 @@ void TaskBase::TaskDestroy() {
 
 void TaskBase::Loop() {
   ocm::rt::set_thread_name(thread_name_);  // 设置线程名称
-  TimerOnce loop_timer;                    // 创建循环计时器
-  TimerOnce run_timer;                     // 创建运行计时器
-
+  if (monitor_slot_) {
+    monitor_slot_->tid.store(gettid());  // 导出任务线程ID
+  }
   while (thread_alive_.load()) {
     SetRtConfig(system_setting_stop_);   // 设置实时配置
-    state_.store(TaskState::STANDBY);    // 设置任务状态为待命
+    SetState(TaskState::STANDBY);        // 设置任务状态为待命
     start_sem_.acquire();                // 获取启动信号量
     SetRtConfig(system_setting_start_);  // 设置实时配置
 
     std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(sleep_duration_ * 1000)));  // 进入运行循环前的初始休眠
+    timer_->Restart();                                                                                      // 重新开始计时，待命期间不计入超限
 
     while (loop_run_.load()) {
-      timer_->Sleep(GetRunDuration());           // 调用休眠机制
-      loop_duration_.store(loop_timer.getMs());  // 获取循环持续时间
-      run_timer.start();                         // 启动运行计时器
+      timer_->Sleep(GetRunDuration());  // 调用休眠机制
+      RunOnce();                        // 运行任务并记录计时
+    }
+    timer_->Deactivate();  // 通知睡眠机制任务已退出运行循环
+  }
+}
 
-      if (run_flag_.load()) {
-        Run();                             // 执行任务
-        state_.store(TaskState::RUNNING);  // 设置任务状态为运行
-      }
+void TaskBase::RunOnce() {
+  loop_duration_.store(loop_timer_.getMs());  // 获取循环持续时间
+  run_timer_.start();                         // 启动运行计时器
 
-      run_duration_.store(run_timer.getMs());  // 获取运行持续时间
-    }
+  int64_t wake_ns = Monitor::NowNs();
+  int64_t release_ns = timer_->GetReleaseNs();
+  if (release_ns > 0) {
+    wake_latency_hist_->Record(wake_ns - release_ns);  // 记录实际唤醒相对计划释放的延迟
+  }
+
+  if (run_flag_.load()) {
+    TraceScope trace(TraceCategory::TASK, trace_name_);
+    Run();                         // 执行任务
+    SetState(TaskState::RUNNING);  // 设置任务状态为运行
+  }
+
+  run_duration_.store(run_timer_.getMs());  // 获取运行持续时间
+  int64_t end_ns = Monitor::NowNs();
+  run_time_hist_->Record(end_ns - wake_ns);  // 记录运行耗时
+
+  if (monitor_slot_) {
+    // 导出本次循环的计时结果
+    monitor_slot_->Update(static_cast<uint8_t>(state_.load()), loop_duration_.load(), run_duration_.load(), timer_->GetMissCount(), end_ns);
   }
 }
 
@@ -169,6 +675,51 @@ double TaskBase::GetLoopDuration() const {
 
 void TaskBase::SetPeriod(double period) {
   timer_->SetPeriod(period);  // 将周期设置委托给休眠机制
+  if (monitor_slot_) {
+    monitor_slot_->period_ms.store(period * 1000.0);  // 导出任务周期
+  }
+}
+
+void TaskBase::SetPhase(double phase) {
+  timer_->SetPhase(phase);  // 将相位设置委托给休眠机制
+}
+
+void TaskBase::SetOverrunPolicy(OverrunPolicy policy) {
+  timer_->SetOverrunPolicy(policy);  // 将超限策略设置委托给休眠机制
+}
+
+void TaskBase::SetMissCallback(DeadlineMissCallback callback) {
+  timer_->SetMissCallback(std::move(callback));  // 将回调设置委托给休眠机制
+}
+
+uint64_t TaskBase::GetMissCount() const {
+  return timer_->GetMissCount();  // 获取错过截止时间的次数
+}
+
+void TaskBase::SetSpinMargin(double margin, bool auto_calibrate) {
+  timer_->SetSpinMargin(margin, auto_calibrate);  // 将自旋余量设置委托给休眠机制
+}
+
+double TaskBase::GetSpinMargin() const {
+  return timer_->GetSpinMargin();  // 获取当前的自旋余量
+}
+
+void TaskBase::SetTriggerTopics(const std::vector<std::string>& topics, TriggerPolicy policy, double timeout, bool timeout_miss,
+                                bool timeout_aligned) {
+  timer_->SetTriggerTopics(topics, policy, timeout, timeout_miss, timeout_aligned);  // 将话题绑定委托给休眠机制
+}
+
+HistogramSummary TaskBase::GetWakeLatencySummary() const {
+  return wake_latency_hist_->Summary();  // 获取唤醒延迟的统计摘要
+}
+
+HistogramSummary TaskBase::GetRunTimeSummary() const {
+  return run_time_hist_->Summary();  // 获取运行耗时的统计摘要
+}
+
+void TaskBase::ResetTimingStats() {
+  wake_latency_hist_->Reset();  // 清空唤醒延迟统计
+  run_time_hist_->Reset();      // 清空运行耗时统计
 }
 
 std::string TaskBase::GetTaskName() const {
@@ -179,15 +730,45 @@ TaskState TaskBase::GetState() const {
   return state_.load();  // 获取任务的当前状态
 }
 
+void TaskBase::SetState(TaskState state) {
+  if (state_.exchange(state) != state) {
+    StateNotifier::getInstance().Notify();  // 状态变化时唤醒等待者
+  }
+}
+
 void TaskBase::SetRtConfig(const SystemSetting& system_setting) {
   pid_t pid = gettid();  // 获取线程ID
 
-  if (system_setting.priority != 0 && all_priority_enable_) {
+  if (system_setting.sched_policy == SchedPolicy::DEADLINE && all_priority_enable_) {
+    std::vector<int> all_cpus(sysconf(_SC_NPROCESSORS_ONLN));
+    std::iota(all_cpus.begin(), all_cpus.end(), 0);
+    ocm::rt::set_thread_cpu_affinity(pid, all_cpus);  // 截止时间调度要求亲和性覆盖整个根调度域
+
+    uint64_t runtime_ns = static_cast<uint64_t>(std::llround(system_setting.sched_runtime * 1e9));
+    uint64_t deadline_ns = static_cast<uint64_t>(std::llround(system_setting.sched_deadline * 1e9));
+    uint64_t period_ns = static_cast<uint64_t>(std::llround(system_setting.sched_period * 1e9));
+    if (ocm::rt::set_thread_deadline(pid, runtime_ns, deadline_ns, period_ns) == 0) {
+      deadline_active_ = true;
+      logger_->info("[TASK] {} task thread runs with SCHED_DEADLINE, runtime {} ns, deadline {} ns, period {} ns.", thread_name_, runtime_ns,
+                    deadline_ns, period_ns);
+    } else {
+      logger_->error("[TASK] {} task thread failed to set SCHED_DEADLINE: {}", thread_name_, strerror(errno));
+    }
+  } else if (system_setting.priority != 0 && all_priority_enable_) {
     ocm::rt::set_thread_priority(pid, system_setting.priority, SCHED_FIFO);  // 设置线程优先级
+    deadline_active_ = false;
+  } else if (deadline_active_) {
+    ocm::rt::set_thread_priority(pid, 0, SCHED_OTHER);  // 退出截止时间调度，恢复普通调度
+    deadline_active_ = false;
   }
+  timer_->SetYieldOnComplete(deadline_active_);  // 截止时间调度下每次作业结束时放弃剩余预算
 
   if (system_setting.cpu_affinity.size() > 0 && all_cpu_affinity_enable_) {
-    ocm::rt::set_thread_cpu_affinity(pid, system_setting.cpu_affinity);  // 设置线程CPU亲和性
+    if (deadline_active_) {
+      logger_->warn("[TASK] {} task thread ignores cpu_affinity under SCHED_DEADLINE.", thread_name_);
+    } else {
+      ocm::rt::set_thread_cpu_affinity(pid, system_setting.cpu_affinity);  // 设置线程CPU亲和性
+    }
   }
 }
 
@@ -0,0 +1,197 @@
+#include "task/task_graph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include "common/futex.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+#include "task/rt/sched_rt.hpp"
+
+namespace ocm {
+
+namespace {
+
+constexpr int kGraphSpinCount = 2000; /**< 在futex上睡眠前的自旋次数 */
+
+/**
+ * @brief 自旋等待时提示CPU降低功耗并让出流水线资源给同核的超线程。
+ */
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
+
+TaskGraph::TaskGraph(const std::string& name, const std::vector<std::vector<size_t>>& depend, std::function<void(size_t)> run_node,
+                     const SystemSetting& system_setting, bool priority_enable, bool cpu_affinity_enable)
+    : name_(name), node_num_(depend.size()), run_node_(std::move(run_node)), successor_(depend.size()), indegree_(depend.size(), 0) {
+  for (size_t i = 0; i < node_num_; ++i) {
+    for (size_t prev : depend[i]) {
+      if (prev >= node_num_ || prev == i) {
+        throw std::runtime_error("[TaskGraph] Invalid node dependency in task " + name + ".");
+      }
+      successor_[prev].push_back(i);
+      ++indegree_[i];
+    }
+  }
+
+  // 按拓扑排序检查依赖关系中是否存在环
+  std::vector<int> remain = indegree_;
+  std::vector<size_t> order;
+  for (size_t i = 0; i < node_num_; ++i) {
+    if (remain[i] == 0) {
+      root_.push_back(i);
+      order.push_back(i);
+    }
+  }
+  for (size_t k = 0; k < order.size(); ++k) {
+    for (size_t next : successor_[order[k]]) {
+      if (--remain[next] == 0) {
+        order.push_back(next);
+      }
+    }
+  }
+  if (order.size() != node_num_) {
+    throw std::runtime_error("[TaskGraph] Node dependency cycle detected in task " + name + ".");
+  }
+
+  pending_ = std::make_unique<std::atomic<int>[]>(node_num_);
+  slot_ = std::make_unique<std::atomic<int>[]>(node_num_);
+  head_.store(0);
+  tail_.store(0);
+  push_seq_.store(0);
+  push_waiters_.store(0);
+  done_.store(0);
+  cycle_.store(0);
+  alive_.store(true);
+
+  size_t helper_num = 0;
+  if (cpu_affinity_enable && system_setting.cpu_affinity.size() > 1 && node_num_ > 1) {
+    helper_num = std::min(system_setting.cpu_affinity.size() - 1, node_num_ - 1);
+  }
+  for (size_t i = 0; i < helper_num; ++i) {
+    int cpu = system_setting.cpu_affinity[i + 1];
+    int priority = priority_enable ? system_setting.priority : 0;
+    helper_.emplace_back([this, i, cpu, priority] {
+      ocm::rt::set_thread_name(name_ + "_h" + std::to_string(i));  // 设置辅助线程名称
+      pid_t tid = gettid();
+      if (priority != 0) {
+        ocm::rt::set_thread_priority(tid, priority, SCHED_FIFO);  // 与任务线程使用相同的优先级
+      }
+      ocm::rt::set_thread_cpu_affinity(tid, {cpu});  // 绑定到任务CPU亲和性中的一个核心
+      HelperLoop();
+    });
+  }
+  GetLogger()->info("[TaskGraph] Task {} runs {} nodes with {} helper threads.", name_, node_num_, helper_num);
+}
+
+TaskGraph::~TaskGraph() {
+  alive_.store(false);
+  cycle_.fetch_add(1);
+  FutexWake(&cycle_);  // 唤醒辅助线程退出
+  for (auto& thread : helper_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void TaskGraph::Run() {
+  if (node_num_ == 0) {
+    return;
+  }
+  // 上一个周期的所有节点都已完成，此时不会再有入队，可以安全地重置就绪队列
+  for (size_t i = 0; i < node_num_; ++i) {
+    pending_[i].store(indegree_[i], std::memory_order_relaxed);
+    slot_[i].store(-1, std::memory_order_relaxed);
+  }
+  tail_.store(0, std::memory_order_relaxed);
+  done_.store(0, std::memory_order_relaxed);
+  head_.store(0, std::memory_order_release);
+  for (size_t node : root_) {
+    Push(node);
+  }
+  if (!helper_.empty()) {
+    cycle_.fetch_add(1, std::memory_order_release);
+    FutexWake(&cycle_);  // 唤醒辅助线程进入新的周期
+  }
+
+  Work();  // 任务线程同样参与运行节点
+
+  // 周期屏障：等待辅助线程中正在运行的节点结束
+  while (true) {
+    uint32_t done = done_.load(std::memory_order_acquire);
+    if (done == node_num_) {
+      break;
+    }
+    FutexWait(&done_, done);
+  }
+}
+
+size_t TaskGraph::GetHelperNum() const { return helper_.size(); }
+
+void TaskGraph::HelperLoop() {
+  uint32_t seen = cycle_.load(std::memory_order_acquire);
+  while (true) {
+    uint32_t cycle = cycle_.load(std::memory_order_acquire);
+    if (cycle == seen) {
+      FutexWait(&cycle_, seen);  // 等待新的周期
+      continue;
+    }
+    if (!alive_.load()) {
+      break;
+    }
+    seen = cycle;
+    Work();
+  }
+}
+
+void TaskGraph::Work() {
+  while (true) {
+    uint32_t ticket = head_.fetch_add(1, std::memory_order_acq_rel);
+    if (ticket >= node_num_) {
+      return;  // 本周期所有节点都已被领取
+    }
+    size_t node = WaitSlot(ticket);
+    run_node_(node);
+    for (size_t next : successor_[node]) {
+      if (pending_[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Push(next);  // 前驱全部完成，后继节点就绪
+      }
+    }
+    if (done_.fetch_add(1, std::memory_order_acq_rel) + 1 == node_num_ && !helper_.empty()) {
+      FutexWake(&done_);  // 最后一个节点完成，唤醒等待周期结束的任务线程
+    }
+  }
+}
+
+void TaskGraph::Push(size_t node) {
+  uint32_t index = tail_.fetch_add(1, std::memory_order_relaxed);
+  slot_[index].store(static_cast<int>(node), std::memory_order_release);
+  push_seq_.fetch_add(1);
+  if (push_waiters_.load() > 0) {
+    FutexWake(&push_seq_);  // 仅在有线程睡眠等待时进入内核
+  }
+}
+
+size_t TaskGraph::WaitSlot(size_t ticket) {
+  for (int spin = 0;; ++spin) {
+    uint32_t seq = push_seq_.load();  // 先读取futex字再检查位置，保证不会错过检查之后的入队
+    int node = slot_[ticket].load(std::memory_order_acquire);
+    if (node >= 0) {
+      return static_cast<size_t>(node);
+    }
+    if (spin < kGraphSpinCount) {
+      CpuRelax();
+      continue;
+    }
+    push_waiters_.fetch_add(1);
+    FutexWait(&push_seq_, seq);
+    push_waiters_.fetch_sub(1);
+  }
+}
+
+}  // namespace ocm
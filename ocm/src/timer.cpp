@@ -1,16 +1,56 @@
 
 #include "task/timer.hpp"
+#include <algorithm>
 #include <cerrno>
+#include <cmath>
 #include <cstring>
 #include <iostream>
+#include "task/sim_clock.hpp"
 
 namespace ocm {
 
+namespace {
+
+/**
+ * @brief 获取`CLOCK_MONOTONIC`时间，以纳秒为单位。
+ */
+inline int64_t MonotonicNs() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+/**
+ * @brief 自旋等待时提示CPU降低功耗并让出流水线资源给同核的超线程。
+ */
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @brief 获取`TimerOnce`使用的当前时间，启用仿真时间时读取`SimClock`。
+ */
+inline int GetTime(timespec* now) {
+  if (SimClock::IsEnabled()) {
+    int64_t sim_ns = SimClock::getInstance().NowNs();
+    now->tv_sec = static_cast<time_t>(sim_ns / 1000000000LL);
+    now->tv_nsec = static_cast<long>(sim_ns % 1000000000LL);
+    return 0;
+  }
+  return clock_gettime(CLOCK_MONOTONIC, now);
+}
+
+}  // namespace
+
 TimerOnce::TimerOnce() { start(); }
 
 void TimerOnce::start() {
   // 获取当前时间并记录为开始时间
-  if (clock_gettime(CLOCK_MONOTONIC, &_startTime) != 0) {
+  if (GetTime(&_startTime) != 0) {
     std::cerr << "Failed to get start time: " << strerror(errno) << std::endl;
   }
 }
@@ -23,7 +63,7 @@ double TimerOnce::getMs() {
 int64_t TimerOnce::getNs() {
   struct timespec now;
   // 获取当前时间
-  if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+  if (GetTime(&now) != 0) {
     std::cerr << "Failed to get current time: " << strerror(errno) << std::endl;
     return 0;
   }
@@ -46,7 +86,7 @@ double TimerOnce::getSeconds() {
 double TimerOnce::getNowTime() const {
   struct timespec now;
   // 获取当前时间
-  if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+  if (GetTime(&now) != 0) {
     std::cerr << "Failed to get current time: " << strerror(errno) << std::endl;
     return 0.0;
   }
@@ -68,26 +108,144 @@ void TimerLoop::SetPeriod(double period) {
   // 将周期转换为毫秒和纳秒
   period_ms_ = period * 1000.0;
   period_ns_ = static_cast<long>(period * 1e9);
-  ResetClock();  // 重置时钟
-  AddPeriod();   // 安排下一个唤醒时间
+  AlignToPhase();  // 安排下一个唤醒时间
+}
+
+void TimerLoop::SetPhase(double phase) {
+  phase_ns_.store(static_cast<int64_t>(std::llround(phase * 1e9)));
+  phase_changed_.store(true, std::memory_order_release);  // 由循环线程在下一次睡眠时重新对齐
 }
 
+double TimerLoop::GetPhase() const { return static_cast<double>(phase_ns_.load()) / 1e9; }
+
 double TimerLoop::GetPeriod() const {
   // 返回当前循环周期
   return period_ms_;
 }
 
 void TimerLoop::SleepUntilNextLoop() {
-  // 根据唤醒绝对时间休眠直到下一个循环
-  if (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_abs_time_, nullptr) != 0) {
-    std::cerr << "Failed to sleep until next loop: " << strerror(errno) << std::endl;
+  if (phase_changed_.exchange(false, std::memory_order_acquire)) {
+    AlignToPhase();  // 相位已修改，移动到新的相位网格点
+  }
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  int64_t late_ns = static_cast<int64_t>(now.tv_sec - wake_abs_time_.tv_sec) * NS_TO_S + (now.tv_nsec - wake_abs_time_.tv_nsec);
+  if (late_ns > 0 && period_ns_ > 0) {
+    // 运行结束时已超过下一次唤醒时间，即错过了本周期的截止时间
+    uint64_t missed = static_cast<uint64_t>(late_ns / period_ns_) + 1;
+    int64_t wake_ns = static_cast<int64_t>(wake_abs_time_.tv_sec) * NS_TO_S + wake_abs_time_.tv_nsec;
+    int64_t last_missed_ns = wake_ns + static_cast<int64_t>(missed - 1) * period_ns_;
+    if (last_missed_ns > miss_reported_ns_) {
+      // 追赶运行时已上报过的释放不再重复计数，只上报其后新错过的释放
+      uint64_t new_missed = wake_ns > miss_reported_ns_ ? missed : static_cast<uint64_t>((last_missed_ns - miss_reported_ns_) / period_ns_);
+      miss_reported_ns_ = last_missed_ns;
+      miss_count_.fetch_add(1);
+      if (miss_callback_ && new_missed > 0) {
+        miss_callback_(new_missed);
+      }
+    }
+    if (overrun_policy_ == OverrunPolicy::CATCH_UP) {
+      release_ns_ = static_cast<int64_t>(wake_abs_time_.tv_sec) * NS_TO_S + wake_abs_time_.tv_nsec;
+      AddPeriod();  // 立即运行，并只前进一个周期
+      return;
+    } else if (overrun_policy_ == OverrunPolicy::SKIP) {
+      AddPeriod(missed);  // 跳过已错过的周期，对齐到下一个周期网格点
+    } else {
+      ResetClock();  // 以当前时间为起点重新计时
+      AddPeriod();
+    }
+  }
+
+  WaitUntilWakeTime();  // 根据唤醒绝对时间休眠直到下一个循环
+  release_ns_ = static_cast<int64_t>(wake_abs_time_.tv_sec) * NS_TO_S + wake_abs_time_.tv_nsec;  // 记录本次计划释放时间
+  AddPeriod();                                                                                  // 安排下一个唤醒时间
+}
+
+void TimerLoop::Restart() {
+  phase_changed_.store(false);
+  AlignToPhase();  // 安排当前时间之后最近的相位网格点
+}
+
+void TimerLoop::SetOverrunPolicy(OverrunPolicy policy) { overrun_policy_ = policy; }
+
+void TimerLoop::SetMissCallback(DeadlineMissCallback callback) { miss_callback_ = std::move(callback); }
+
+uint64_t TimerLoop::GetMissCount() const { return miss_count_.load(); }
+
+int64_t TimerLoop::GetReleaseNs() const { return release_ns_; }
+
+void TimerLoop::SetHybridSpin(bool enable) {
+  hybrid_spin_ = enable;
+  if (hybrid_spin_ && !sleep_latency_) {
+    sleep_latency_ = std::make_unique<LatencyHistogram>();  // 分配校准所需的直方图
+    sleep_latency_->Reset();
+  }
+}
+
+void TimerLoop::SetSpinMargin(double margin, bool auto_calibrate) {
+  spin_margin_ns_.store(std::max<int64_t>(0, static_cast<int64_t>(margin * 1e9)));
+  auto_calibrate_ = auto_calibrate;
+  if (sleep_latency_) {
+    sleep_latency_->Reset();  // 以新的余量重新开始校准窗口
+  }
+}
+
+double TimerLoop::GetSpinMargin() const { return static_cast<double>(spin_margin_ns_.load()) / 1e9; }
+
+void TimerLoop::AlignToPhase() {
+  int64_t now_ns = MonotonicNs();
+  int64_t wake_ns = now_ns + period_ns_;
+  if (period_ns_ > 0) {
+    int64_t offset = ((phase_ns_.load() - now_ns) % period_ns_ + period_ns_) % period_ns_;  // 到下一个相位网格点的距离
+    wake_ns = now_ns + (offset == 0 ? period_ns_ : offset);
+  }
+  time_s_ = static_cast<long>(wake_ns / NS_TO_S);
+  time_ns_ = static_cast<long>(wake_ns % NS_TO_S);
+  wake_abs_time_.tv_sec = time_s_;
+  wake_abs_time_.tv_nsec = time_ns_;
+}
+
+void TimerLoop::WaitUntilWakeTime() {
+  if (!hybrid_spin_) {
+    if (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_abs_time_, nullptr) != 0) {
+      std::cerr << "Failed to sleep until next loop: " << strerror(errno) << std::endl;
+    }
+    return;
+  }
+
+  int64_t target_ns = static_cast<int64_t>(wake_abs_time_.tv_sec) * NS_TO_S + wake_abs_time_.tv_nsec;
+  int64_t sleep_ns = target_ns - spin_margin_ns_.load(std::memory_order_relaxed);
+  int64_t now_ns = MonotonicNs();
+  if (sleep_ns > now_ns) {
+    timespec sleep_abs_time = {static_cast<time_t>(sleep_ns / NS_TO_S), static_cast<long>(sleep_ns % NS_TO_S)};
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sleep_abs_time, nullptr);  // 先睡眠到截止时间前的余量处
+    now_ns = MonotonicNs();
+    if (auto_calibrate_) {
+      CalibrateSpinMargin(now_ns - sleep_ns);
+    }
+  }
+  while (now_ns < target_ns) {
+    CpuRelax();  // 在余量内自旋等待截止时间
+    now_ns = MonotonicNs();
+  }
+}
+
+void TimerLoop::CalibrateSpinMargin(int64_t latency_ns) {
+  int64_t max_margin_ns = std::max<int64_t>(kMinSpinMarginNs, period_ns_ / 2);  // 保留至少半个周期的睡眠
+  sleep_latency_->Record(latency_ns);
+  if (latency_ns > spin_margin_ns_.load(std::memory_order_relaxed)) {
+    spin_margin_ns_.store(std::min(latency_ns + latency_ns / 8, max_margin_ns), std::memory_order_relaxed);  // 唤醒晚于余量，立即放大
+  }
+  if (sleep_latency_->count.load(std::memory_order_relaxed) >= kCalibrateWindow) {
+    int64_t p999 = sleep_latency_->Summary().p999;
+    spin_margin_ns_.store(std::clamp(p999 + p999 / 8, kMinSpinMarginNs, max_margin_ns), std::memory_order_relaxed);  // 按窗口内的p99.9重新计算
+    sleep_latency_->Reset();
   }
-  AddPeriod();  // 安排下一个唤醒时间
 }
 
-void TimerLoop::AddPeriod() {
+void TimerLoop::AddPeriod(uint64_t count) {
   // 将循环周期添加到当前唤醒时间
-  time_ns_ += period_ns_;
+  time_ns_ += static_cast<long>(count) * period_ns_;
   if (time_ns_ > NS_CARRY) {
     time_s_ += time_ns_ / NS_TO_S;  // 处理纳秒溢出
     time_ns_ %= NS_TO_S;
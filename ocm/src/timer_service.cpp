@@ -0,0 +1,200 @@
+#include "task/timer_service.hpp"
+
+#include <cmath>
+#include <cstring>
+#include "common/futex.hpp"
+#include "task/rt/sched_rt.hpp"
+
+namespace ocm {
+
+TimerService::TimerService() : current_tick_(0), tick_ns_(1000000) {
+  logger_ = GetLogger();  // 获取日志记录器
+  std::memset(wheel0_, 0, sizeof(wheel0_));
+  std::memset(wheel_, 0, sizeof(wheel_));
+  system_setting_.priority = 0;
+  running_.store(false);
+}
+
+TimerService::~TimerService() {
+  running_.store(false);  // 通知时钟线程退出
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+TimerService& TimerService::getInstance() {
+  static TimerService instance;
+  return instance;
+}
+
+void TimerService::Configure(double tick, const SystemSetting& system_setting) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_.load()) {
+    logger_->warn("[TimerService] Clock thread is already running, configure ignored.");
+    return;
+  }
+  tick_ns_ = std::max(1L, static_cast<long>(std::llround(tick * 1e9)));  // 节拍至少为1纳秒
+  system_setting_ = system_setting;
+}
+
+double TimerService::GetTick() const { return static_cast<double>(tick_ns_) / 1e9; }
+
+void TimerService::Add(TimerServiceEntry* entry, double period, double phase) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entry->active) {
+    Unlink(entry);  // 重新调度已存在的定时器
+  }
+  if (!running_.load()) {
+    // 节拍对齐到`CLOCK_MONOTONIC`的绝对网格，相位与内部定时器按同一原点计算
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    current_tick_ = static_cast<uint64_t>((static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec) / tick_ns_);
+  }
+  double period_ticks = period * 1e9 / static_cast<double>(tick_ns_);
+  double phase_ticks = phase * 1e9 / static_cast<double>(tick_ns_);
+  entry->period_ticks = std::max<uint64_t>(1, std::llround(period_ticks));
+  entry->phase_ticks = static_cast<uint64_t>(std::max<long long>(0, std::llround(phase_ticks))) % entry->period_ticks;
+  if (std::fabs(period_ticks - std::round(period_ticks)) > 1e-6 || std::fabs(phase_ticks - std::round(phase_ticks)) > 1e-6) {
+    // 周期或相位不是节拍的整数倍时按节拍四舍五入，实际周期与配置不同
+    logger_->warn("[TimerService] Period {} s / phase {} s is not a multiple of the {} ns tick, rounded to {} / {} ticks.", period, phase, tick_ns_,
+                  entry->period_ticks, entry->phase_ticks);
+  }
+  entry->expires = NextExpires(entry);
+  Insert(entry);
+
+  if (!running_.load()) {
+    running_.store(true);
+    thread_ = std::thread([this] { Loop(); });  // 第一个定时器加入时启动时钟线程
+    logger_->info("[TimerService] Clock thread started with {} ns tick.", tick_ns_);
+  }
+}
+
+void TimerService::Restart(TimerServiceEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entry->active) {
+    Unlink(entry);
+  }
+  entry->phase_ticks = current_tick_ % entry->period_ticks;  // 周期网格改为以当前节拍为起点
+  entry->expires = current_tick_ + entry->period_ticks;
+  Insert(entry);
+}
+
+void TimerService::Remove(TimerServiceEntry* entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entry->active) {
+    Unlink(entry);
+  }
+}
+
+void TimerService::Loop() {
+  ocm::rt::set_thread_name("timer_service");  // 设置线程名称
+  pid_t tid = gettid();
+  if (system_setting_.priority != 0) {
+    ocm::rt::set_thread_priority(tid, system_setting_.priority, SCHED_FIFO);  // 设置时钟线程优先级
+  }
+  if (!system_setting_.cpu_affinity.empty()) {
+    ocm::rt::set_thread_cpu_affinity(tid, system_setting_.cpu_affinity);  // 设置时钟线程CPU亲和性
+  }
+
+  uint64_t tick = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tick = current_tick_;
+  }
+  while (running_.load()) {
+    int64_t next_ns = static_cast<int64_t>(++tick) * tick_ns_;  // 第`tick`个节拍的绝对时间
+    timespec next;
+    next.tv_sec = static_cast<time_t>(next_ns / 1000000000LL);
+    next.tv_nsec = static_cast<long>(next_ns % 1000000000LL);
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);  // 迟到时立即返回，逐节拍追赶
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Advance();
+  }
+}
+
+void TimerService::Advance() {
+  ++current_tick_;
+  uint64_t index = current_tick_ & (kLevel0Size - 1);
+  if (index == 0) {
+    // 第0层回绕一圈，将上层对应槽位中的定时器逐层下放
+    int level = 0;
+    while (level < kLevelNum - 1 && Cascade(level, (current_tick_ >> (kLevel0Bits + level * kLevelBits)) & (kLevelSize - 1))) {
+      ++level;
+    }
+  }
+
+  TimerServiceEntry* entry = wheel0_[index];
+  wheel0_[index] = nullptr;
+  while (entry) {
+    TimerServiceEntry* next = entry->next;
+    entry->active = false;
+    if (entry->expires <= current_tick_) {
+      entry->release_ns.store(static_cast<int64_t>(current_tick_) * tick_ns_, std::memory_order_relaxed);
+      entry->seq.fetch_add(1, std::memory_order_release);
+      FutexWake(&entry->seq);  // 直接唤醒到期的任务
+      entry->expires = NextExpires(entry);
+    }
+    Insert(entry);
+    entry = next;
+  }
+}
+
+void TimerService::Insert(TimerServiceEntry* entry) {
+  uint64_t expires = entry->expires;
+  uint64_t delta = expires - current_tick_;
+  if (delta >= kMaxDelta) {
+    expires = current_tick_ + kMaxDelta - 1;  // 超出范围时先放入最高层的最远槽位，级联时再重新计算
+    delta = kMaxDelta - 1;
+  }
+
+  TimerServiceEntry** head = nullptr;
+  if (delta < kLevel0Size) {
+    head = &wheel0_[expires & (kLevel0Size - 1)];
+  } else {
+    for (int level = 0; level < kLevelNum - 1; ++level) {
+      int shift = kLevel0Bits + level * kLevelBits;
+      if (delta < (1ULL << (shift + kLevelBits))) {
+        head = &wheel_[level][(expires >> shift) & (kLevelSize - 1)];
+        break;
+      }
+    }
+  }
+
+  entry->next = *head;
+  if (entry->next) {
+    entry->next->pprev = &entry->next;
+  }
+  entry->pprev = head;
+  *head = entry;
+  entry->active = true;
+}
+
+void TimerService::Unlink(TimerServiceEntry* entry) {
+  *entry->pprev = entry->next;
+  if (entry->next) {
+    entry->next->pprev = entry->pprev;
+  }
+  entry->next = nullptr;
+  entry->pprev = nullptr;
+  entry->active = false;
+}
+
+bool TimerService::Cascade(int level, uint64_t index) {
+  TimerServiceEntry* entry = wheel_[level][index];
+  wheel_[level][index] = nullptr;
+  while (entry) {
+    TimerServiceEntry* next = entry->next;
+    Insert(entry);
+    entry = next;
+  }
+  return index == 0;
+}
+
+uint64_t TimerService::NextExpires(const TimerServiceEntry* entry) const {
+  uint64_t tick = current_tick_ + 1;
+  uint64_t offset = (entry->phase_ticks + entry->period_ticks - tick % entry->period_ticks) % entry->period_ticks;
+  return tick + offset;  // 严格晚于当前节拍且满足相位约束的最近节拍
+}
+
+}  // namespace ocm
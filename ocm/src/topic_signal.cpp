@@ -0,0 +1,98 @@
+#include "ocm/topic_signal.hpp"
+
+#include <cstring>
+#include <ctime>
+#include "common/futex.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+
+namespace ocm {
+
+TopicSignal::TopicSignal() : segment_(nullptr) {
+  try {
+    shm_ = std::make_unique<SharedMemoryData<TopicSignalSegment>>(kTopicSignalShmName, true, sizeof(TopicSignalSegment));
+    shm_->Lock();
+    uint32_t magic = shm_->Get()->magic.load();
+    if (magic == 0) {
+      shm_->Get()->magic.store(kTopicSignalMagic);  // 首次创建的共享内存段
+      magic = kTopicSignalMagic;
+    }
+    shm_->UnLock();
+    if (magic == kTopicSignalMagic) {
+      segment_ = shm_->Get();
+    } else {
+      GetLogger()->error("[TopicSignal] Shared memory layout mismatch, topic trigger disabled.");
+    }
+  } catch (const std::runtime_error& e) {
+    GetLogger()->error("[TopicSignal] {}, topic trigger disabled.", e.what());
+  }
+}
+
+TopicSignal& TopicSignal::getInstance() {
+  static TopicSignal instance;
+  return instance;
+}
+
+TopicSignalSlot* TopicSignal::GetSlot(const std::string& topic_name) {
+  if (!segment_) {
+    return nullptr;
+  }
+  if (topic_name.size() >= kTopicSignalNameSize) {
+    // 截断后的名称会与共享相同前缀的其它话题冲突，因此拒绝过长的名称
+    GetLogger()->error("[TopicSignal] Topic name {} exceeds {} characters, topic can not trigger tasks.", topic_name, kTopicSignalNameSize - 1);
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slot_map_.find(topic_name);
+  if (it != slot_map_.end()) {
+    return it->second;
+  }
+
+  shm_->Lock();
+  TopicSignalSlot* result = nullptr;
+  TopicSignalSlot* free_slot = nullptr;
+  for (auto& slot : segment_->slot) {
+    if (slot.ready.load()) {
+      if (std::strcmp(slot.name, topic_name.c_str()) == 0) {
+        result = &slot;
+        break;
+      }
+    } else if (!free_slot) {
+      free_slot = &slot;
+    }
+  }
+  if (!result && free_slot) {
+    result = free_slot;
+    std::memcpy(result->name, topic_name.c_str(), topic_name.size() + 1);  // 名称长度已校验，含'\0'完整写入
+    result->ready.store(1, std::memory_order_release);
+  }
+  shm_->UnLock();
+
+  if (!result) {
+    GetLogger()->warn("[TopicSignal] Topic slots are full, topic {} can not trigger tasks.", topic_name);
+    return nullptr;
+  }
+  slot_map_.emplace(topic_name, result);
+  return result;
+}
+
+void TopicSignal::Notify(TopicSignalSlot* slot) {
+  if (!slot) {
+    return;
+  }
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  slot->publish_ns.store(static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec, std::memory_order_relaxed);
+  slot->seq.fetch_add(1, std::memory_order_release);
+  slot->wake.fetch_add(1);
+  if (slot->waiters.load() > 0) {
+    FutexWake(&slot->wake, INT_MAX, true);  // 仅在有订阅者等待该话题时进入内核
+  }
+  segment_->epoch.fetch_add(1);
+  if (slot->epoch_waiters.load() > 0) {
+    FutexWake(&segment_->epoch, INT_MAX, true, TopicSignalBit(segment_, slot));  // 只唤醒绑定了本话题位的多话题订阅者
+  }
+}
+
+TopicSignalSegment* TopicSignal::GetSegment() { return segment_; }
+
+}  // namespace ocm
@@ -0,0 +1,205 @@
+#include "monitor/trace.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <chrono>
+#include "log_anywhere/log_anywhere.hpp"
+#include "monitor/monitor.hpp"
+
+namespace ocm {
+
+namespace {
+
+constexpr const char* kTraceCategoryName[] = {"task", "node", "executer", "publish", "subscribe", "semaphore"}; /**< 事件类别名称 */
+
+/**
+ * @brief 将字符串转义为JSON字符串内容。
+ */
+std::string EscapeJson(const std::string& str) {
+  std::string result;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+      result.push_back(c);
+    } else if (static_cast<unsigned char>(c) >= 0x20) {
+      result.push_back(c);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+Trace& Trace::getInstance() {
+  static Trace instance;
+  return instance;
+}
+
+Trace::~Trace() { Stop(); }
+
+bool Trace::Start(const std::string& file_path, double flush_period) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_) {
+    GetLogger()->warn("[Trace] Trace is already recording.");
+    return false;
+  }
+  file_ = std::fopen(file_path.c_str(), "w");
+  if (!file_) {
+    GetLogger()->error("[Trace] Failed to open trace file {}.", file_path);
+    return false;
+  }
+  std::fputs("{\"traceEvents\":[", file_);
+  first_event_ = true;
+
+  // 以一段短暂的睡眠估计时间戳计数的频率，此后每次刷新按更长的区间重新估计
+  start_tick_ = Now();
+  start_ns_ = Monitor::NowNs();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  uint64_t tick = Now();
+  int64_t ns = Monitor::NowNs();
+  ns_per_tick_ = tick > start_tick_ ? static_cast<double>(ns - start_ns_) / static_cast<double>(tick - start_tick_) : 1.0;
+
+  {
+    std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+    for (auto& buffer : buffer_) {
+      buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);  // 丢弃上一次记录残留的事件
+      buffer->drop.store(0, std::memory_order_relaxed);
+      buffer->thread_named = false;
+    }
+  }
+
+  stop_ = false;
+  enabled_.store(true, std::memory_order_release);
+  flush_thread_ = std::thread([this, flush_period] { FlushLoop(flush_period); });
+  GetLogger()->info("[Trace] Trace recording to {}.", file_path);
+  return true;
+}
+
+void Trace::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_) {
+      return;
+    }
+    enabled_.store(false, std::memory_order_release);
+    stop_ = true;
+  }
+  stop_cv_.notify_all();
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  Flush();  // 写出剩余事件
+  std::fputs("]}\n", file_);
+  std::fclose(file_);
+  file_ = nullptr;
+
+  uint64_t drop = 0;
+  {
+    std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+    for (auto& buffer : buffer_) {
+      drop += buffer->drop.load(std::memory_order_relaxed);
+    }
+  }
+  if (drop > 0) {
+    GetLogger()->warn("[Trace] {} trace events were dropped because the buffers were full.", drop);
+  }
+  GetLogger()->info("[Trace] Trace recording stopped.");
+}
+
+uint32_t Trace::Intern(const std::string& name) {
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+  auto it = name_index_.find(name);
+  if (it != name_index_.end()) {
+    return it->second;
+  }
+  uint32_t index = static_cast<uint32_t>(name_.size());
+  name_.push_back(EscapeJson(name));
+  name_index_.emplace(name, index);
+  return index;
+}
+
+TraceBuffer* Trace::RegisterThread() {
+  auto buffer = std::make_unique<TraceBuffer>();
+  buffer->head.store(0);
+  buffer->tail.store(0);
+  buffer->drop.store(0);
+  buffer->tid = static_cast<int>(gettid());
+  char thread_name[16] = {0};
+  pthread_getname_np(pthread_self(), thread_name, sizeof(thread_name));
+  buffer->thread_name = EscapeJson(thread_name);
+  buffer->thread_named = false;
+
+  std::lock_guard<std::mutex> lock(registry_mutex_);
+  buffer_.push_back(std::move(buffer));
+  return buffer_.back().get();
+}
+
+void Trace::FlushLoop(double flush_period) {
+  pthread_setname_np(pthread_self(), "ocm_trace");  // 设置刷新线程名称
+  sched_param param{};
+  pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);  // 刷新线程使用普通调度，不继承调用者的实时优先级
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    stop_cv_.wait_for(lock, std::chrono::duration<double>(flush_period), [this] { return stop_; });
+    if (!stop_) {
+      Flush();
+    }
+  }
+}
+
+void Trace::Flush() {
+  // 只在拷贝缓冲区列表与名称时持有登记锁，写文件期间其它线程仍可登记
+  std::vector<TraceBuffer*> buffers;
+  std::vector<std::string> names;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (auto& buffer : buffer_) {
+      buffers.push_back(buffer.get());
+    }
+    names = name_;
+  }
+
+  // 按更长的区间重新估计时间戳计数的频率
+  uint64_t tick = Now();
+  int64_t ns = Monitor::NowNs();
+  if (tick > start_tick_ && ns - start_ns_ > 100000000LL) {
+    ns_per_tick_ = static_cast<double>(ns - start_ns_) / static_cast<double>(tick - start_tick_);
+  }
+
+  int pid = static_cast<int>(getpid());
+  for (TraceBuffer* buffer : buffers) {
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+    if (head == tail) {
+      continue;
+    }
+    if (!buffer->thread_named) {
+      buffer->thread_named = true;
+      std::fprintf(file_, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first_event_ ? "" : ",",
+                   pid, buffer->tid, buffer->thread_name.c_str());
+      first_event_ = false;
+    }
+    for (uint64_t i = tail; i < head; ++i) {
+      const TraceEvent& event = buffer->event[i & (kTraceBufferSize - 1)];
+      double ts_us = (start_ns_ + static_cast<double>(static_cast<int64_t>(event.start - start_tick_)) * ns_per_tick_) * 1e-3;
+      const char* name = event.name < names.size() ? names[event.name].c_str() : "unknown";
+      const char* category = kTraceCategoryName[static_cast<int>(event.category)];
+      if (event.end == event.start) {
+        std::fprintf(file_, ",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d}", name, category, ts_us, pid,
+                     buffer->tid);
+      } else {
+        double dur_us = static_cast<double>(event.end - event.start) * ns_per_tick_ * 1e-3;
+        std::fprintf(file_, ",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}", name, category, ts_us,
+                     dur_us, pid, buffer->tid);
+      }
+    }
+    buffer->tail.store(head, std::memory_order_release);  // 归还已写出的位置
+  }
+  std::fflush(file_);
+}
+
+}  // namespace ocm
@@ -0,0 +1,196 @@
+#include "task/worker_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <string>
+#include "task/rt/sched_rt.hpp"
+
+namespace ocm {
+
+namespace {
+
+/**
+ * @brief 获取`CLOCK_MONOTONIC`时间，以纳秒为单位。
+ */
+inline int64_t MonotonicNs() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+}  // namespace
+
+WorkerPool::WorkerPool() : worker_num_(2) {
+  logger_ = GetLogger();  // 获取日志记录器
+  system_setting_.priority = 0;
+  running_.store(false);
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_.store(false);  // 通知工作线程退出
+  }
+  ready_cv_.notify_all();
+  for (auto& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+WorkerPool& WorkerPool::getInstance() {
+  static WorkerPool instance;
+  return instance;
+}
+
+void WorkerPool::Configure(int worker_num, const SystemSetting& system_setting) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_.load()) {
+    logger_->warn("[WorkerPool] Worker threads are already running, configure ignored.");
+    return;
+  }
+  worker_num_ = std::max(1, worker_num);
+  system_setting_ = system_setting;
+}
+
+void WorkerPool::Add(WorkerPoolJob* job) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  jobs_.push_back(job);
+
+  if (!running_.load()) {
+    running_.store(true);
+    for (int i = 0; i < worker_num_; ++i) {
+      threads_.emplace_back([this, i] { Loop(i); });  // 第一个作业登记时启动工作线程
+    }
+    logger_->info("[WorkerPool] {} worker threads started.", worker_num_);
+  }
+}
+
+void WorkerPool::Remove(WorkerPoolJob* job) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  job->active = false;
+  if (job->runner != std::this_thread::get_id()) {
+    idle_cv_.wait(lock, [job] { return !job->running; });  // 等待正在运行的作业结束
+  }
+  jobs_.erase(std::remove(jobs_.begin(), jobs_.end(), job), jobs_.end());
+}
+
+void WorkerPool::SetTiming(WorkerPoolJob* job, double period, double phase) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job->period_ns = std::max<int64_t>(1, std::llround(period * 1e9));
+    job->phase_ns = std::llround(phase * 1e9);
+    if (!job->active) {
+      return;
+    }
+    job->next_release_ns = NextAligned(job, MonotonicNs() + 1);  // 移动到新的相位网格点
+  }
+  ready_cv_.notify_all();
+}
+
+void WorkerPool::Activate(WorkerPoolJob* job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job->active = true;
+    job->next_release_ns = NextAligned(job, MonotonicNs() + std::max<int64_t>(1, job->start_delay_ns));
+  }
+  ready_cv_.notify_all();  // 让等待中的工作线程重新计算最近的释放时刻
+}
+
+void WorkerPool::Deactivate(WorkerPoolJob* job) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  job->active = false;
+  if (job->runner != std::this_thread::get_id()) {
+    idle_cv_.wait(lock, [job] { return !job->running; });  // 等待正在运行的作业结束
+  }
+}
+
+void WorkerPool::Loop(int index) {
+  ocm::rt::set_thread_name("worker_pool_" + std::to_string(index));  // 设置线程名称
+  pid_t tid = gettid();
+  if (system_setting_.priority != 0) {
+    ocm::rt::set_thread_priority(tid, system_setting_.priority, SCHED_FIFO);  // 设置工作线程优先级
+  }
+  if (!system_setting_.cpu_affinity.empty()) {
+    ocm::rt::set_thread_cpu_affinity(tid, system_setting_.cpu_affinity);  // 设置工作线程CPU亲和性
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_.load()) {
+    // 在已释放的作业中选出截止时间最早的一个，同时记录尚未释放作业中最近的释放时刻
+    int64_t now_ns = MonotonicNs();
+    WorkerPoolJob* job = nullptr;
+    int64_t wake_ns = std::numeric_limits<int64_t>::max();
+    for (auto* entry : jobs_) {
+      if (!entry->active || entry->running) {
+        continue;
+      }
+      if (entry->next_release_ns > now_ns) {
+        wake_ns = std::min(wake_ns, entry->next_release_ns);
+      } else if (!job || entry->next_release_ns + entry->period_ns < job->next_release_ns + job->period_ns) {
+        job = entry;
+      }
+    }
+
+    if (!job) {
+      if (wake_ns == std::numeric_limits<int64_t>::max()) {
+        ready_cv_.wait(lock);
+      } else {
+        ready_cv_.wait_until(lock, std::chrono::steady_clock::time_point(std::chrono::nanoseconds(wake_ns)));
+      }
+      continue;
+    }
+
+    job->running = true;
+    job->runner = std::this_thread::get_id();
+    job->release_ns.store(job->next_release_ns, std::memory_order_relaxed);
+    lock.unlock();
+    job->run();  // 在锁外运行作业
+    now_ns = MonotonicNs();
+    lock.lock();
+    uint64_t missed = job->active ? ScheduleNext(job, now_ns) : 0;
+    if (missed > 0 && job->miss_callback) {
+      lock.unlock();
+      job->miss_callback(missed);  // 作业仍标记为运行中，回调期间不会被注销
+      lock.lock();
+    }
+    job->running = false;
+    job->runner = std::thread::id();
+    idle_cv_.notify_all();
+  }
+}
+
+uint64_t WorkerPool::ScheduleNext(WorkerPoolJob* job, int64_t now_ns) {
+  job->next_release_ns += job->period_ns;
+  if (job->next_release_ns > now_ns) {
+    return 0;
+  }
+
+  // 运行结束时已到达下一次释放时刻，即错过了本周期的截止时间
+  uint64_t missed = static_cast<uint64_t>((now_ns - job->next_release_ns) / job->period_ns) + 1;
+  int64_t last_missed_ns = job->next_release_ns + static_cast<int64_t>(missed - 1) * job->period_ns;
+  uint64_t new_missed = 0;
+  if (last_missed_ns > job->miss_reported_ns) {
+    // 追赶运行时已上报过的释放不再重复计数，只上报其后新错过的释放
+    new_missed = job->next_release_ns > job->miss_reported_ns ? missed
+                                                               : static_cast<uint64_t>((last_missed_ns - job->miss_reported_ns) / job->period_ns);
+    job->miss_reported_ns = last_missed_ns;
+    job->miss_count.fetch_add(1);
+  }
+  if (job->overrun_policy == OverrunPolicy::SKIP) {
+    job->next_release_ns += static_cast<int64_t>(missed) * job->period_ns;  // 跳过已错过的周期，对齐到下一个周期网格点
+  } else if (job->overrun_policy == OverrunPolicy::RESTART) {
+    job->next_release_ns = now_ns + job->period_ns;  // 以当前时间为起点重新计时
+  }
+  return new_missed;  // CATCH_UP保持已到期的释放时刻，立即再次运行
+}
+
+int64_t WorkerPool::NextAligned(const WorkerPoolJob* job, int64_t from_ns) {
+  int64_t offset = ((job->phase_ns - from_ns) % job->period_ns + job->period_ns) % job->period_ns;
+  return from_ns + offset;
+}
+
+}  // namespace ocm
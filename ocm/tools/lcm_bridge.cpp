@@ -0,0 +1,89 @@
+#include <signal.h>
+#include <yaml-cpp/yaml.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "bridge/lcm_bridge.hpp"
+#include "log_anywhere/log_anywhere.hpp"
+
+using namespace ocm;
+
+namespace {
+
+/**
+ * @brief 从YAML节点读取话题列表。
+ */
+std::vector<LcmBridgeTopic> LoadTopicList(const YAML::Node& node) {
+  std::vector<LcmBridgeTopic> topic_list;
+  for (const auto& item : node) {
+    LcmBridgeTopic topic;
+    topic.topic_name = item["topic_name"].as<std::string>();
+    topic.shm_name = item["shm_name"] ? item["shm_name"].as<std::string>() : topic.topic_name;
+    topic.channel = item["channel"] ? item["channel"].as<std::string>() : topic.topic_name;
+    if (item["max_rate"]) topic.max_rate = item["max_rate"].as<double>();
+    topic_list.push_back(topic);
+  }
+  return topic_list;
+}
+
+/**
+ * @brief 从YAML文件读取桥接配置。
+ */
+LcmBridgeConfig LoadConfig(const std::string& path) {
+  YAML::Node root = YAML::LoadFile(path);
+  LcmBridgeConfig config;
+  if (root["multicast_ip"]) config.multicast_ip = root["multicast_ip"].as<std::string>();
+  if (root["port"]) config.port = root["port"].as<int>();
+  if (root["ttl"]) config.ttl = root["ttl"].as<int>();
+  if (root["interface_ip"]) config.interface_ip = root["interface_ip"].as<std::string>();
+  if (root["period"]) config.period = root["period"].as<double>();
+  if (root["batch_size"]) config.batch_size = root["batch_size"].as<size_t>();
+  if (root["all_priority_enable"]) config.all_priority_enable = root["all_priority_enable"].as<bool>();
+  if (root["all_cpu_affinity_enable"]) config.all_cpu_affinity_enable = root["all_cpu_affinity_enable"].as<bool>();
+  config.system_setting.priority = 0;
+  if (root["system_setting"]) {
+    const auto& system_setting = root["system_setting"];
+    if (system_setting["priority"]) config.system_setting.priority = system_setting["priority"].as<int>();
+    if (system_setting["cpu_affinity"]) config.system_setting.cpu_affinity = system_setting["cpu_affinity"].as<std::vector<int>>();
+  }
+  if (root["outbound"]) config.outbound = LoadTopicList(root["outbound"]);
+  if (root["inbound"]) config.inbound = LoadTopicList(root["inbound"]);
+  return config;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: ocm-lcm-bridge <config.yaml>" << std::endl;
+    return 1;
+  }
+
+  // 在创建任何线程之前屏蔽退出信号，由主线程统一等待
+  sigset_t signal_set;
+  sigemptyset(&signal_set);
+  sigaddset(&signal_set, SIGINT);
+  sigaddset(&signal_set, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signal_set, nullptr);
+
+  LoggerConfig log_config;
+  log_config.log_file = "logs/ocm_lcm_bridge.log";
+  auto logger_generator = std::make_shared<LogAnywhere>(log_config);
+
+  LcmBridgeConfig config;
+  try {
+    config = LoadConfig(argv[1]);
+  } catch (const YAML::Exception& e) {
+    std::cerr << "Failed to load config " << argv[1] << ": " << e.what() << std::endl;
+    return 1;
+  }
+
+  LcmBridge bridge(config);
+
+  int signal_number = 0;
+  sigwait(&signal_set, &signal_number);  // 等待退出信号
+
+  bridge.TaskDestroy();
+  GetLogger()->info("[LcmBridge] Exit, sent {}, received {}, dropped {}.", bridge.GetSendCount(), bridge.GetReceiveCount(), bridge.GetDropCount());
+  return 0;
+}
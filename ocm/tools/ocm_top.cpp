@@ -0,0 +1,173 @@
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "monitor/monitor.hpp"
+
+using namespace ocm;
+
+namespace {
+
+volatile sig_atomic_t g_running = 1; /**< 退出标志 */
+
+/**
+ * @brief 上一次刷新时的计数，用于计算频率。
+ */
+struct PreviousCount {
+  uint64_t count = 0;  /**< 计数值 */
+  int64_t time_ns = 0; /**< 采样时间 */
+};
+
+/**
+ * @brief 将任务状态转换为字符串。
+ */
+const char* TaskStateName(uint8_t state) {
+  switch (state) {
+    case 0:
+      return "INIT";
+    case 1:
+      return "RUNNING";
+    case 2:
+      return "STANDBY";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+/**
+ * @brief 根据计数增量计算频率（Hz）。
+ */
+double UpdateRate(std::unordered_map<std::string, PreviousCount>& previous, const std::string& key, uint64_t count, int64_t now_ns) {
+  auto& prev = previous[key];
+  double rate = 0.0;
+  if (prev.time_ns > 0 && now_ns > prev.time_ns && count >= prev.count) {
+    rate = static_cast<double>(count - prev.count) * 1e9 / static_cast<double>(now_ns - prev.time_ns);
+  }
+  prev.count = count;
+  prev.time_ns = now_ns;
+  return rate;
+}
+
+/**
+ * @brief 获取已排序样本的分位数。
+ */
+double Percentile(const std::vector<int64_t>& sorted, double p) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+  return static_cast<double>(sorted[index]);
+}
+
+/**
+ * @brief 绘制一帧任务、节点与话题表格。
+ */
+void Draw(const MonitorSegment* segment, std::unordered_map<std::string, PreviousCount>& previous) {
+  int64_t now_ns = Monitor::NowNs();
+  std::printf("\033[H\033[2J");  // 清屏并将光标移到左上角
+  std::printf("ocm-top  (Ctrl-C to quit)\n\n");
+
+  std::printf("%-24s %8s %8s %-8s %10s %8s %10s %10s %10s %12s %8s\n", "TASK", "PID", "TID", "STATE", "PERIOD_MS", "RATE_HZ", "LOOP_MS", "RUN_MS",
+              "MAX_RUN_MS", "LOOPS", "MISSES");
+  for (size_t i = 0; i < kMonitorTaskSlotNum; ++i) {
+    const auto& slot = segment->task_slot[i];
+    if (slot.slot_state.load(std::memory_order_acquire) != MonitorSlotState::READY) {
+      continue;
+    }
+    MonitorTaskSnapshot task = slot.Read();
+    bool alive = kill(task.pid, 0) == 0 || errno != ESRCH;
+    double rate = UpdateRate(previous, "task:" + std::to_string(i), task.loop_count, now_ns);
+    std::printf("%-24.24s %8d %8d %-8s %10.3f %8.1f %10.3f %10.3f %10.3f %12lu %8lu\n", task.name.c_str(), task.pid, task.tid,
+                alive ? TaskStateName(task.state) : "DEAD", task.period_ms, rate, task.loop_duration_ms, task.run_duration_ms, task.max_run_duration_ms,
+                static_cast<unsigned long>(task.loop_count), static_cast<unsigned long>(task.miss_count));
+  }
+
+  std::printf("\n%-24s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "TASK TIMING (US)", "WAKE_P50", "WAKE_P99", "WAKE_P999", "WAKE_MAX",
+              "RUN_MIN", "RUN_MEAN", "RUN_P99", "RUN_P999", "RUN_MAX");
+  for (size_t i = 0; i < kMonitorTaskSlotNum; ++i) {
+    const auto& slot = segment->task_slot[i];
+    if (slot.slot_state.load(std::memory_order_acquire) != MonitorSlotState::READY) {
+      continue;
+    }
+    HistogramSummary wake = slot.wake_latency.Summary();
+    HistogramSummary run = slot.run_time.Summary();
+    std::printf("%-24.24s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", slot.name, wake.p50 / 1e3, wake.p99 / 1e3, wake.p999 / 1e3,
+                wake.max / 1e3, run.min / 1e3, run.mean / 1e3, run.p99 / 1e3, run.p999 / 1e3, run.max / 1e3);
+  }
+
+  std::printf("\n%-24s %-16s %10s %10s %10s %10s %10s %10s %12s\n", "NODE TIMING (US)", "TASK", "EXEC_P50", "EXEC_P99", "EXEC_MAX", "OUT_P99",
+              "OUT_MAX", "INIT_MAX", "WORST_AGE_S");
+  for (size_t i = 0; i < kMonitorNodeSlotNum; ++i) {
+    const auto& slot = segment->node_slot[i];
+    if (slot.slot_state.load(std::memory_order_acquire) != MonitorSlotState::READY) {
+      continue;
+    }
+    HistogramSummary execute = slot.profile.Summary(NodePhase::EXECUTE);
+    HistogramSummary output = slot.profile.Summary(NodePhase::OUTPUT);
+    HistogramSummary init = slot.profile.Summary(NodePhase::INIT);
+    NodeWorstCase worst = slot.profile.Worst(NodePhase::EXECUTE);
+    double worst_age_s = worst.time_ns > 0 ? static_cast<double>(now_ns - worst.time_ns) / 1e9 : 0.0;  // 最长执行耗时发生在多久之前
+    std::printf("%-24.24s %-16.16s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %12.1f\n", slot.name, slot.task_name, execute.p50 / 1e3,
+                execute.p99 / 1e3, execute.max / 1e3, output.p99 / 1e3, output.max / 1e3, init.max / 1e3, worst_age_s);
+  }
+
+  std::printf("\n%-32s %8s %10s %10s %10s %10s %10s %10s\n", "TOPIC", "SIZE_B", "RATE_HZ", "AGE_MS", "LAT_P50_US", "LAT_P99_US", "LAT_MAX_US",
+              "RECEIVED");
+  for (size_t i = 0; i < kMonitorTopicSlotNum; ++i) {
+    const auto& slot = segment->topic_slot[i];
+    if (slot.slot_state.load(std::memory_order_acquire) != MonitorSlotState::READY) {
+      continue;
+    }
+    MonitorTopicSnapshot topic = slot.Read();
+    double rate = UpdateRate(previous, "topic:" + std::to_string(i), topic.publish_count, now_ns);
+    double age_ms = topic.last_publish_ns > 0 ? static_cast<double>(now_ns - topic.last_publish_ns) / 1e6 : 0.0;
+    std::sort(topic.latency_ns.begin(), topic.latency_ns.end());
+    std::printf("%-32.32s %8u %10.1f %10.1f %10.1f %10.1f %10.1f %10lu\n", topic.name.c_str(), topic.size, rate, age_ms,
+                Percentile(topic.latency_ns, 0.5) / 1e3, Percentile(topic.latency_ns, 0.99) / 1e3,
+                topic.latency_ns.empty() ? 0.0 : static_cast<double>(topic.latency_ns.back()) / 1e3, static_cast<unsigned long>(topic.receive_count));
+  }
+  std::fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double refresh_rate = 4.0;
+  int opt;
+  while ((opt = getopt(argc, argv, "r:h")) != -1) {
+    if (opt == 'r') {
+      refresh_rate = std::atof(optarg);
+    } else {
+      std::cerr << "Usage: ocm-top [-r refresh_hz]" << std::endl;
+      return opt == 'h' ? 0 : 1;
+    }
+  }
+  if (refresh_rate <= 0) {
+    refresh_rate = 4.0;
+  }
+
+  signal(SIGINT, [](int) { g_running = 0; });
+  signal(SIGTERM, [](int) { g_running = 0; });
+
+  const MonitorSegment* segment = Monitor::getInstance().GetSegment();  // 直接映射监控共享内存，无需与被监控进程交互
+  if (!segment) {
+    std::cerr << "Failed to map monitor shared memory." << std::endl;
+    return 1;
+  }
+
+  std::unordered_map<std::string, PreviousCount> previous;
+  auto interval = std::chrono::microseconds(static_cast<int64_t>(1e6 / refresh_rate));
+  while (g_running) {
+    Draw(segment, previous);
+    std::this_thread::sleep_for(interval);
+  }
+  return 0;
+}